@@ -0,0 +1,107 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "real_type.H"
+#include "precision.H"
+#include "fermi_integrals.H"
+
+// Time FermiIntegral::evaluate() for each number type built into the
+// executable (or just real_t), over a set of (k, η, β) spanning the
+// regimes the EOS uses.
+//
+// usage: fermi_benchmark [--precision NAME] [--mode M] [--repeat N]
+
+// describe the number type, including the Boost backend
+
+template <typename T>
+auto description() -> std::string_view
+{
+    if constexpr (is_boost_real_v<T>) {
+#if defined(USE_BOOST256_MPFR)
+        return "boost256 (MPFR)";
+#elif defined(USE_BOOST256_ET)
+        return "boost256 (cpp_bin_float, expression templates)";
+#else
+        return "boost256 (cpp_bin_float)";
+#endif
+    } else {
+        return precision::name<T>();
+    }
+}
+
+template <typename T>
+auto benchmark(int mode, int repeat) -> int
+{
+    constexpr std::array<long double, 3> ks{0.5L, 1.5L, 2.5L};
+    constexpr std::array<long double, 6> etas{-50.0L, -5.0L, 0.0L, 5.0L, 50.0L, 500.0L};
+    constexpr std::array<long double, 3> betas{1.e-3L, 1.0L, 30.0L};
+
+    // a sum of the results, so the work can't be optimized away
+    T checksum{};
+
+    const auto start = std::chrono::steady_clock::now();
+
+    for (int n = 0; n < repeat; ++n) {
+        for (auto k : ks) {
+            for (auto eta : etas) {
+                for (auto beta : betas) {
+                    FermiIntegral<T> f(static_cast<T>(k), static_cast<T>(eta), static_cast<T>(beta));
+                    f.evaluate(mode);
+                    checksum += f.F;
+                }
+            }
+        }
+    }
+
+    const std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    const int n_evals = repeat * static_cast<int>(ks.size() * etas.size() * betas.size());
+
+    std::println("{:>48}: {:12.2f} µs per evaluate  (checksum {:.6e})",
+                 description<T>(), elapsed.count() / n_evals, static_cast<double>(checksum));
+
+    return 0;
+}
+
+auto main(int argc, char* argv[]) -> int
+{
+    std::string_view type_name;
+    int mode{3};
+    int repeat{1};
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--precision" && i + 1 < argc) {
+            type_name = argv[++i];
+        } else if (arg == "--mode" && i + 1 < argc) {
+            mode = std::atoi(argv[++i]);
+        } else if (arg == "--repeat" && i + 1 < argc) {
+            repeat = std::atoi(argv[++i]);
+        } else {
+            std::cerr << "usage: fermi_benchmark [--precision NAME] [--mode M] [--repeat N]" << std::endl;
+            return 1;
+        }
+    }
+
+    std::println("FermiIntegral::evaluate({}), {} repeats of 54 (k, η, β)", mode, repeat);
+
+    if (!type_name.empty()) {
+        if (!precision::dispatch(type_name, [&] <typename T> () { return benchmark<T>(mode, repeat); })) {
+            std::cerr << "unknown precision " << type_name << ", available:";
+            for (auto p : precision::available()) {
+                std::cerr << " " << p;
+            }
+            std::cerr << std::endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    []<typename... Ts>(std::type_identity<std::tuple<Ts...>>, int m, int r) {
+        (benchmark<Ts>(m, r), ...);
+    }(std::type_identity<precision::types>{}, mode, repeat);
+}
@@ -0,0 +1,119 @@
+#include <array>
+#include <cstdlib>
+#include <iostream>
+#include <print>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "real_type.H"
+#include "counting_real.H"
+#include "electron_positron.H"
+
+// Count the arithmetic operations and mp:: calls in each phase of an
+// EOS call (see counting_real.H), for a set of (ρ, T) spanning the
+// non-degenerate, degenerate, and relativistic regimes, or for a
+// single state given on the command line.  Unlike the timings, the
+// counts are the same on any machine.
+//
+// usage: op_count [--deriv-level L] [rho T Ye]
+
+using R = counting::real;
+
+template <int deriv_level>
+auto count_state(const double rho, const double temp, const double Ye) -> counting::Counts
+{
+    ElectronPositronEOS<R, deriv_level> eos;
+
+    // the first call also builds the constants, so count the second
+
+    [[maybe_unused]] const auto warm_up = eos.try_pe_state(rho, temp, Ye);
+
+    counting::reset();
+    auto state = eos.try_pe_state(rho, temp, Ye);
+    const counting::Counts counts = counting::counts;
+
+    if (!state) {
+        std::println("ρ = {:g}, T = {:g}, Ye = {:g}:", rho, temp, Ye);
+        std::cout << "EOS failed: " << state.error() << "\n" << std::endl;
+        return counts;
+    }
+
+    std::println("ρ = {:g}, T = {:g}, Ye = {:g}: η = {:g}\n", rho, temp, Ye, static_cast<double>(state->eta));
+    std::println("{}", counting::report(counts));
+
+    return counts;
+}
+
+template <int deriv_level>
+auto count_states(const std::span<const std::array<double, 3>> states) -> int
+{
+    std::println("operation counts for pe_state, deriv_level = {}\n", deriv_level);
+
+    counting::Counts total;
+    for (auto [rho, temp, Ye] : states) {
+        total += count_state<deriv_level>(rho, temp, Ye);
+    }
+
+    if (states.size() > 1) {
+        std::println("all {} states:\n", states.size());
+        std::println("{}", counting::report(total));
+    }
+
+    return 0;
+}
+
+auto main([[maybe_unused]] int argc, [[maybe_unused]] char* argv[]) -> int
+{
+#if defined(USE_BOOST256) || defined(USE_FLOAT128) || defined(USE_LONG_DOUBLE) || defined(USE_DD) || defined(USE_QD)
+
+    // the constants and literals are real_t, which counting::real only
+    // converts from if it is a double
+
+    std::cerr << "op_count needs PRECISION=COUNTING (or DOUBLE)" << std::endl;
+    return 1;
+
+#else
+
+    int deriv_level{3};
+
+    std::vector<std::array<double, 3>> states{
+        {1.e-2, 1.e9, 0.5}, {1.e2, 1.e6, 0.5}, {1.e4, 1.e7, 0.5}, {1.e5, 1.e8, 0.5},
+        {1.e7, 1.e8, 0.5}, {1.e5, 5.e9, 0.5}, {5.e9, 5.e9, 0.5}, {1.e9, 1.e4, 0.5}};
+
+    std::vector<double> values;
+    bool valid{true};
+    for (int i = 1; i < argc; ++i) {
+        const std::string_view arg = argv[i];
+        if (arg == "--deriv-level" && i + 1 < argc) {
+            deriv_level = std::atoi(argv[++i]);
+        } else if (!arg.starts_with("--")) {
+            values.push_back(std::atof(argv[i]));
+        } else {
+            valid = false;
+        }
+    }
+
+    if (!valid || values.size() % 3 != 0 || deriv_level < 1 || deriv_level > 3) {
+        std::cerr << "usage: op_count [--deriv-level L] [rho T Ye]" << std::endl;
+        return 1;
+    }
+
+    if (!values.empty()) {
+        states.clear();
+        for (std::size_t i = 0; i < values.size(); i += 3) {
+            states.push_back({values[i], values[i+1], values[i+2]});
+        }
+    }
+
+    switch (deriv_level) {
+    case 1:
+        return count_states<1>(states);
+    case 2:
+        return count_states<2>(states);
+    default:
+        return count_states<3>(states);
+    }
+
+#endif
+}
@@ -1,14 +1,62 @@
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <print>
+#include <type_traits>
 
 #include "real_type.H"
 #include "electron_positron.H"
+#include "eos_cache.H"
+#include "batch_stream.H"
+#include "precision.H"
 
+// the columns written in batch mode: the totals and their first
+// derivatives
 
-auto main() -> int
+template <typename T>
+using BatchState = EOSState<T, 1>;
+
+template <typename T>
+const std::array<batch_stream::Column<BatchState<T>, T>, 16> batch_columns{{
+    {"eta", &BatchState<T>::eta},
+    {"beta", &BatchState<T>::beta},
+    {"n", &BatchState<T>::n},
+    {"p", &BatchState<T>::p},
+    {"e", &BatchState<T>::e},
+    {"s", &BatchState<T>::s},
+    {"deta_drho", &BatchState<T>::deta_drho},
+    {"deta_dT", &BatchState<T>::deta_dT},
+    {"dn_drho", &BatchState<T>::dn_drho},
+    {"dn_dT", &BatchState<T>::dn_dT},
+    {"dp_drho", &BatchState<T>::dp_drho},
+    {"dp_dT", &BatchState<T>::dp_dT},
+    {"de_drho", &BatchState<T>::de_drho},
+    {"de_dT", &BatchState<T>::de_dT},
+    {"ds_drho", &BatchState<T>::ds_drho},
+    {"ds_dT", &BatchState<T>::ds_dT}}};
+
+
+// evaluate the EOS in the number type T.  The cache holds real_t
+// results, so it is only used when T is real_t.
+
+template <typename T>
+auto run(const batch_stream::Options& opts) -> int
 {
 
+    if (opts.batch) {
+        auto cache = EOSCache<BatchState<real_t>>::from_environment("EOSState<1>");
+        ElectronPositronEOS<T, 1> eos;
+
+        return batch_stream::run_driver<BatchState<T>, T>(opts, batch_columns<T>,
+            [&] (T rho, T temp, T Ye) {
+                if constexpr (std::is_same_v<T, real_t>) {
+                    return cache.get_or_compute(rho, temp, Ye, [&] { return eos.try_pe_state(rho, temp, Ye); });
+                } else {
+                    return eos.try_pe_state(rho, temp, Ye);
+                }
+            });
+    }
+
     std::println("Enter rho, T, Ye (space-separated): ");
     double rho_{};
     double T_{};
@@ -18,13 +66,52 @@ auto main() -> int
 
     assert (rho_ != 0.0 && T_ != 0.0 && Ye_ != 0.0);
 
-    auto rho = static_cast<real_t>(rho_);
-    auto T = static_cast<real_t>(T_);
-    auto Ye = static_cast<real_t>(Ye_);
+    auto rho = static_cast<T>(rho_);
+    auto temp = static_cast<T>(T_);
+    auto Ye = static_cast<T>(Ye_);
+
+    // reuse a previous result if EOS_CACHE_DIR is set
+    auto cache = EOSCache<EOSState<real_t>>::from_environment("EOSState<3>");
+
+    ElectronPositronEOS<T> eos;
+    auto state = [&] {
+        if constexpr (std::is_same_v<T, real_t>) {
+            return cache.get_or_compute(rho, temp, Ye, [&] { return eos.try_pe_state(rho, temp, Ye); });
+        } else {
+            return eos.try_pe_state(rho, temp, Ye);
+        }
+    }();
+
+    if (!state) {
+        std::cout << "EOS failed: " << state.error() << std::endl;
+        return 1;
+    }
+
+    std::cout << *state << std::endl;
+
+    return 0;
+}
+
+
+auto main(int argc, char* argv[]) -> int
+{
+
+    auto opts = batch_stream::parse_options(argc, argv);
+    if (!opts) {
+        std::cerr << opts.error() << "\n" << batch_stream::usage << std::endl;
+        return 1;
+    }
 
-    ElectronPositronEOS<real_t> eos;
-    auto state = eos.pe_state(rho, T, Ye);
+    auto status = precision::dispatch(opts->precision, [&] <typename T> () { return run<T>(*opts); });
+    if (!status) {
+        std::cerr << "unknown precision " << opts->precision << ", available:";
+        for (auto p : precision::available()) {
+            std::cerr << " " << p;
+        }
+        std::cerr << std::endl;
+        return 1;
+    }
 
-    std::cout << state << std::endl;
+    return *status;
 
 }
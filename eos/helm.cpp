@@ -1,14 +1,59 @@
+#include <array>
 #include <cassert>
 #include <iostream>
 #include <print>
+#include <type_traits>
 
 #include "real_type.H"
 #include "helmholtz.H"
+#include "eos_cache.H"
+#include "batch_stream.H"
+#include "precision.H"
 
+// the columns written in batch mode
 
-auto main() -> int
+template <typename T>
+const std::array<batch_stream::Column<Helmholtz<T>, T>, 9> batch_columns{{
+    {"F", &Helmholtz<T>::F},
+    {"dF_drho", &Helmholtz<T>::dF_drho},
+    {"dF_dT", &Helmholtz<T>::dF_dT},
+    {"d2F_drho2", &Helmholtz<T>::d2F_drho2},
+    {"d2F_dT2", &Helmholtz<T>::d2F_dT2},
+    {"d2F_drhodT", &Helmholtz<T>::d2F_drhodT},
+    {"d3F_drhodT2", &Helmholtz<T>::d3F_drhodT2},
+    {"d3F_drho2dT", &Helmholtz<T>::d3F_drho2dT},
+    {"d4F_drho2dT2", &Helmholtz<T>::d4F_drho2dT2}}};
+
+
+// evaluate the Helmholtz free energy in the number type T.  The cache
+// holds real_t results, so it is only used when T is real_t.
+
+template <typename T>
+auto run(const batch_stream::Options& opts) -> int
 {
 
+    // reuse a previous result if EOS_CACHE_DIR is set
+    auto cache = EOSCache<HelmholtzEntry<real_t>>::from_environment("HelmholtzEntry");
+
+    auto get_terms = [&] (T rho, T temp, T Ye) {
+        if constexpr (std::is_same_v<T, real_t>) {
+            return cache.get_or_compute(rho, temp, Ye, [&] { return try_get_helmholtz_entry(rho, temp, Ye); });
+        } else {
+            return try_get_helmholtz_entry(rho, temp, Ye);
+        }
+    };
+
+    if (opts.batch) {
+        return batch_stream::run_driver<Helmholtz<T>, T>(opts, batch_columns<T>,
+            [&] (T rho, T temp, T Ye) -> std::expected<Helmholtz<T>, EOSStatus> {
+                auto terms = get_terms(rho, temp, Ye);
+                if (!terms) {
+                    return std::unexpected(terms.error());
+                }
+                return terms->helm;
+            });
+    }
+
     std::println("Enter rho, T, Ye (space-separated): ");
     double rho_{};
     double T_{};
@@ -18,12 +63,42 @@ auto main() -> int
 
     assert (rho_ != 0.0 && T_ != 0.0 && Ye_ != 0.0);
 
-    auto rho = static_cast<real_t>(rho_);
-    auto T = static_cast<real_t>(T_);
-    auto Ye = static_cast<real_t>(Ye_);
+    auto rho = static_cast<T>(rho_);
+    auto temp = static_cast<T>(T_);
+    auto Ye = static_cast<T>(Ye_);
+
+    auto terms = get_terms(rho, temp, Ye);
+
+    if (!terms) {
+        std::cout << "EOS failed: " << terms.error() << std::endl;
+        return 1;
+    }
+
+    std::cout << terms->helm << std::endl;
+
+    return 0;
+}
+
+
+auto main(int argc, char* argv[]) -> int
+{
+
+    auto opts = batch_stream::parse_options(argc, argv);
+    if (!opts) {
+        std::cerr << opts.error() << "\n" << batch_stream::usage << std::endl;
+        return 1;
+    }
 
-    auto [helm, eos] = get_helmholtz_terms(rho, T, Ye);
+    auto status = precision::dispatch(opts->precision, [&] <typename T> () { return run<T>(*opts); });
+    if (!status) {
+        std::cerr << "unknown precision " << opts->precision << ", available:";
+        for (auto p : precision::available()) {
+            std::cerr << " " << p;
+        }
+        std::cerr << std::endl;
+        return 1;
+    }
 
-    std::cout << helm << std::endl;
+    return *status;
 
 }
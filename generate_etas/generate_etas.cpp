@@ -1,7 +1,6 @@
 #include <array>
 #include <ranges>
 #include <iostream>
-#include <stdexcept>
 
 #include "real_type.H"
 #include "brent.H"
@@ -36,21 +35,22 @@ auto main() -> int
     for (auto [ir, rho] : std::views::enumerate(rhoYes_v)) {
         for (auto [it, T] : std::views::enumerate(Ts_v)) {
 
-            real_t eta{};
             const real_t beta = C::dbeta_dT * T;
             const real_t n_e_net = rho * Ye * C::N_A;
 
-            try {
-                eta = brent<real_t>([=] (real_t _eta) -> real_t
-                    {
-                        auto n_e = n_e_constraint(_eta, beta);
-                        auto n_pos = n_p_constraint(_eta, beta);
-                        return n_e_net - (n_e - n_pos);
-                    }, -100.0_rt, 1.e12_rt);
-            } catch (const std::out_of_range& e) {
+            auto root = brent<real_t>([=] (real_t _eta) -> real_t
+                {
+                    auto n_e = n_e_constraint(_eta, beta);
+                    auto n_pos = n_p_constraint(_eta, beta);
+                    return n_e_net - (n_e - n_pos);
+                }, -100.0_rt, 1.e12_rt);
+
+            if (!root) {
                 util::red_println("bounds failed for rho = {:8.3g}, T = {:8.3g}", rho, T);
             }
 
+            const real_t eta = root.value_or(0.0_rt);
+
             if (it == 0) {
                 if (ir == 0) {
                     std::cout << "{{";
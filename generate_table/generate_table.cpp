@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <format>
 #include <fstream>
 #include <print>
@@ -7,8 +8,13 @@
 #include "real_type.H"
 #include "electron_positron.H"
 #include "helmholtz.H"
+#include "eos_cache.H"
 #include "util.H"
 
+#if defined(USE_ADAPTIVE_PRECISION)
+#include "adaptive_precision.H"
+#endif
+
 // create a table in the format of the Timmes & Swesty (2000) EOS.
 
 
@@ -38,6 +44,22 @@ const real_t T_hi{11.0e0_rt};
 const real_t dlogrho = (rho_hi - rho_lo) / (static_cast<real_t>(rho_pts-1));
 const real_t dlogT = (T_hi - T_lo) / (static_cast<real_t>(T_pts-1));
 
+#if defined(USE_ADAPTIVE_PRECISION)
+
+// each point is evaluated in the cheapest of double, long double, and
+// __float128 whose error estimate is below this (see
+// adaptive_precision.H), and the table is stored in the last
+
+constexpr double adaptive_tolerance{1.e-13};
+
+using table_t = DefaultAdaptivePrecision::output_type;
+
+#else
+
+using table_t = real_t;
+
+#endif
+
 
 auto main() -> int
 {
@@ -58,7 +80,9 @@ auto main() -> int
 #endif
 
     std::string precision;
-#if defined(USE_BOOST256)
+#if defined(USE_ADAPTIVE_PRECISION)
+    precision = "adaptive";
+#elif defined(USE_BOOST256)
     precision = "256";
 #elif defined(USE_FLOAT128)
     precision = "128";
@@ -73,8 +97,24 @@ auto main() -> int
 
     // we'll compute everything first and then output
 
-    std::vector<Helmholtz<real_t>> helm_v(T_pts * rho_pts);
-    std::vector<EOSState<real_t>> eos_v(T_pts * rho_pts);
+    std::vector<Helmholtz<table_t>> helm_v(T_pts * rho_pts);
+    std::vector<EOSTotals<table_t>> eos_v(T_pts * rho_pts);
+
+    // a point that fails is left as zeros in the table, and we record
+    // why in the status table
+
+    std::vector<EOSStatus> status_v(T_pts * rho_pts, EOSStatus::success);
+
+    // points computed in a previous run are reused if EOS_CACHE_DIR
+    // is set.  The table is only visited once, so we skip the
+    // in-memory tier.
+
+#if defined(USE_ADAPTIVE_PRECISION)
+    DefaultAdaptivePrecision adaptive(adaptive_tolerance);
+    auto cache = EOSCache<HelmholtzEntry<table_t>>::from_environment("HelmholtzEntryAdaptive", 0);
+#else
+    auto cache = EOSCache<HelmholtzEntry<real_t>>::from_environment("HelmholtzEntry", 0);
+#endif
 
     // we will have OpenMP schedule things such that each thread is
     // working on similar temperatures, to better load balance
@@ -84,13 +124,13 @@ auto main() -> int
 #ifdef USE_FAST_MATH
         real_t T = mp::fastpow2(T_lo + static_cast<real_t>(j) * dlogT);
 #else
-        real_t T = std::pow(10.0_rt, T_lo + static_cast<real_t>(j) * dlogT);
+        real_t T = mp::pow(10.0_rt, T_lo + static_cast<real_t>(j) * dlogT);
 #endif
         for (int i = 0; i < rho_pts; ++i) {
 #ifdef USE_FAST_MATH
             real_t rho = mp::fastpow2(rho_lo + static_cast<real_t>(i) * dlogrho);
 #else
-            real_t rho = std::pow(10.0_rt, rho_lo + static_cast<real_t>(i) * dlogrho);
+            real_t rho = mp::pow(10.0_rt, rho_lo + static_cast<real_t>(i) * dlogrho);
 #endif
 
             // in the table, density varies fastest
@@ -99,21 +139,36 @@ auto main() -> int
 
             util::println("rho = {}, T = {}", rho, T);
 
-            auto [helm, eos] = get_helmholtz_terms<real_t>(rho, T, Ye);
+            auto terms = cache.get_or_compute(rho, T, Ye,
+                                              [&] {
+#if defined(USE_ADAPTIVE_PRECISION)
+                                                  return adaptive.try_helmholtz_entry(rho, T, Ye);
+#else
+                                                  return try_get_helmholtz_entry<real_t>(rho, T, Ye);
+#endif
+                                              });
 
-            helm_v[index] = helm;
-            eos_v[index] = eos;
+            if (terms) {
+                helm_v[index] = terms->helm;
+                eos_v[index] = terms->totals;
+            } else {
+                util::red_println("failed at rho = {}, T = {}: {}", rho, T,
+                                  status_message(terms.error()));
+                status_v[index] = terms.error();
+            }
 
         }
 
     }
 
 #ifdef USE_FAST_MATH
-    std::ofstream of(std::format("helm_table_fastmath_p{}_q{}.dat", precision, qnpts));
+    const std::string table_name = std::format("helm_table_fastmath_p{}_q{}", precision, qnpts);
 #else
-    std::ofstream of(std::format("helm_table_p{}_q{}.dat", precision, qnpts));
+    const std::string table_name = std::format("helm_table_p{}_q{}", precision, qnpts);
 #endif
 
+    std::ofstream of(table_name + ".dat");
+
     // there are 4 tables.  First is the free energy table
 
     for (auto & h : helm_v) {
@@ -158,7 +213,28 @@ auto main() -> int
                        rho_lo, rho_hi, rho_pts);
     of << util::format("# log10(T_lo) = {}, log10(T_hi) = {}, T_pts = {}\n",
                        T_lo, T_hi, T_pts);
+#if defined(USE_ADAPTIVE_PRECISION)
+    of << util::format("# precision = adaptive, tolerance = {}\n", adaptive_tolerance);
+#else
     of << util::format("# precision = {} bits\n", precision);
+#endif
     of << util::format("# number of quadrature points = {}\n", qnpts);
+#if defined(USE_ADAPTIVE_PRECISION)
+    for (const auto& [name, count] : adaptive.counts()) {
+        of << util::format("# points evaluated in {} = {}\n", name, count);
+    }
+#endif
+
+    const auto n_failed = std::ranges::count_if(status_v,
+                                                [] (EOSStatus s) { return s != EOSStatus::success; });
+    of << util::format("# number of failed points = {}\n", n_failed);
+
+    // the status of each point, in the same order as the tables above
+
+    std::ofstream of_status(table_name + "_status.dat");
+
+    for (auto s : status_v) {
+        of_status << static_cast<int>(s) << "\n";
+    }
 
 }
@@ -0,0 +1,254 @@
+#include <cstddef>
+#include <expected>
+#include <limits>
+
+#include "real_type.H"
+#include "eos_status.H"
+#include "eos_types.H"
+#include "electron_positron.H"
+#include "helmholtz.H"
+
+#include "eleceos.h"
+
+// The C interface in eleceos.h.  Everything here is evaluated in
+// real_t and converted to / from double at the boundary.  The EOS
+// calls used are the try_ versions, so nothing throws across the C
+// boundary.
+
+namespace {
+
+    constexpr int deriv_level{1};
+
+    using State = EOSTotals<real_t, deriv_level>;
+
+    auto to_real(double x) -> real_t
+    {
+        return static_cast<real_t>(x);
+    }
+
+    auto to_double(real_t x) -> double
+    {
+        return static_cast<double>(x);
+    }
+
+    void store_state(const State& es, double* out)
+    {
+        out[ELECEOS_RHO] = to_double(es.rho);
+        out[ELECEOS_TEMP] = to_double(es.temp);
+        out[ELECEOS_YE] = to_double(es.Y_e);
+        out[ELECEOS_ETA] = to_double(es.eta);
+        out[ELECEOS_BETA] = to_double(es.beta);
+        out[ELECEOS_N] = to_double(es.n);
+        out[ELECEOS_P] = to_double(es.p);
+        out[ELECEOS_E] = to_double(es.e);
+        out[ELECEOS_S] = to_double(es.s);
+        out[ELECEOS_DETA_DRHO] = to_double(es.deta_drho);
+        out[ELECEOS_DETA_DT] = to_double(es.deta_dT);
+        out[ELECEOS_DN_DRHO] = to_double(es.dn_drho);
+        out[ELECEOS_DN_DT] = to_double(es.dn_dT);
+        out[ELECEOS_DP_DRHO] = to_double(es.dp_drho);
+        out[ELECEOS_DP_DT] = to_double(es.dp_dT);
+        out[ELECEOS_DE_DRHO] = to_double(es.de_drho);
+        out[ELECEOS_DE_DT] = to_double(es.de_dT);
+        out[ELECEOS_DS_DRHO] = to_double(es.ds_drho);
+        out[ELECEOS_DS_DT] = to_double(es.ds_dT);
+    }
+
+    void store_helmholtz(const Helmholtz<real_t>& helm, double* out)
+    {
+        out[ELECEOS_F] = to_double(helm.F);
+        out[ELECEOS_DF_DRHO] = to_double(helm.dF_drho);
+        out[ELECEOS_DF_DT] = to_double(helm.dF_dT);
+        out[ELECEOS_D2F_DRHO2] = to_double(helm.d2F_drho2);
+        out[ELECEOS_D2F_DT2] = to_double(helm.d2F_dT2);
+        out[ELECEOS_D2F_DRHODT] = to_double(helm.d2F_drhodT);
+        out[ELECEOS_D3F_DRHODT2] = to_double(helm.d3F_drhodT2);
+        out[ELECEOS_D3F_DRHO2DT] = to_double(helm.d3F_drho2dT);
+        out[ELECEOS_D4F_DRHO2DT2] = to_double(helm.d4F_drho2dT2);
+    }
+
+    void zero(double* out, int n)
+    {
+        for (int i = 0; i < n; ++i) {
+            out[i] = 0.0;
+        }
+    }
+
+    // the single-point calls.  Each writes its record to out (zero
+    // on failure) and returns the status
+
+    auto state(double rho, double temp, double Ye, double* out) -> int
+    {
+        ElectronPositronEOS<real_t, deriv_level> eos;
+        auto es = eos.try_pe_state(to_real(rho), to_real(temp), to_real(Ye));
+        if (!es) {
+            zero(out, ELECEOS_STATE_SIZE);
+            return static_cast<int>(es.error());
+        }
+        store_state(State(*es), out);
+        return ELECEOS_SUCCESS;
+    }
+
+    auto helmholtz(double rho, double temp, double Ye, double* out) -> int
+    {
+        auto terms = try_get_helmholtz_terms(to_real(rho), to_real(temp), to_real(Ye));
+        if (!terms) {
+            zero(out, ELECEOS_HELMHOLTZ_SIZE);
+            return static_cast<int>(terms.error());
+        }
+        store_helmholtz(terms->first, out);
+        return ELECEOS_SUCCESS;
+    }
+
+    auto eta(double rho, double temp, double Ye, double* out) -> int
+    {
+        auto result = get_eta(to_real(rho) * to_real(Ye), to_real(temp));
+        if (!result) {
+            zero(out, 1);
+            return static_cast<int>(result.error());
+        }
+        *out = to_double(*result);
+        return ELECEOS_SUCCESS;
+    }
+
+    // the inverse calls, for the solve given by the member function
+
+    using InverseSolve =
+        std::expected<EOSState<real_t, deriv_level>, EOSStatus>
+        (ElectronPositronEOS<real_t, deriv_level>::*)(real_t, real_t, real_t, real_t);
+
+    auto inverse(InverseSolve solve, double rho, double value, double Ye, double temp_guess, double* out) -> int
+    {
+        ElectronPositronEOS<real_t, deriv_level> eos;
+        auto es = (eos.*solve)(to_real(rho), to_real(value), to_real(Ye), to_real(temp_guess));
+        if (!es) {
+            zero(out, ELECEOS_STATE_SIZE);
+            return static_cast<int>(es.error());
+        }
+        store_state(State(*es), out);
+        return ELECEOS_SUCCESS;
+    }
+
+    // apply a single-point call to each point of a batch, where
+    // point(i, out) evaluates point i into out.  The cost of a point
+    // varies with the thermodynamic state, so we use dynamic
+    // scheduling.
+
+    template <typename F>
+    auto batch(std::size_t npts, int record_size, double* out, int* status, F&& point) -> std::size_t
+    {
+        std::size_t n_failed{};
+
+        #pragma omp parallel for schedule(dynamic) reduction(+:n_failed)
+        for (std::size_t i = 0; i < npts; ++i) {
+            const int s = point(i, out + i * record_size);
+            if (status != nullptr) {
+                status[i] = s;
+            }
+            if (s != ELECEOS_SUCCESS) {
+                ++n_failed;
+            }
+        }
+
+        return n_failed;
+    }
+
+}
+
+
+extern "C" {
+
+const char* eleceos_status_message(int status)
+{
+    // status_message returns views of string literals, so these are
+    // null-terminated
+    return status_message(static_cast<EOSStatus>(status)).data();
+}
+
+int eleceos_precision_digits()
+{
+    return std::numeric_limits<real_t>::digits;
+}
+
+int eleceos_pe_state(double rho, double temp, double Ye, double* out)
+{
+    return state(rho, temp, Ye, out);
+}
+
+size_t eleceos_pe_state_batch(size_t npts, const double* rho, const double* temp,
+                              const double* Ye, double* out, int* status)
+{
+    return batch(npts, ELECEOS_STATE_SIZE, out, status,
+                 [=] (std::size_t i, double* o) { return state(rho[i], temp[i], Ye[i], o); });
+}
+
+int eleceos_helmholtz(double rho, double temp, double Ye, double* out)
+{
+    return helmholtz(rho, temp, Ye, out);
+}
+
+size_t eleceos_helmholtz_batch(size_t npts, const double* rho, const double* temp,
+                               const double* Ye, double* out, int* status)
+{
+    return batch(npts, ELECEOS_HELMHOLTZ_SIZE, out, status,
+                 [=] (std::size_t i, double* o) { return helmholtz(rho[i], temp[i], Ye[i], o); });
+}
+
+int eleceos_get_eta(double rho, double temp, double Ye, double* out)
+{
+    return eta(rho, temp, Ye, out);
+}
+
+size_t eleceos_get_eta_batch(size_t npts, const double* rho, const double* temp,
+                             const double* Ye, double* out, int* status)
+{
+    return batch(npts, 1, out, status,
+                 [=] (std::size_t i, double* o) { return eta(rho[i], temp[i], Ye[i], o); });
+}
+
+int eleceos_pe_state_from_e(double rho, double e, double Ye, double temp_guess, double* out)
+{
+    return inverse(&ElectronPositronEOS<real_t, deriv_level>::try_pe_state_from_e,
+                   rho, e, Ye, temp_guess, out);
+}
+
+int eleceos_pe_state_from_p(double rho, double p, double Ye, double temp_guess, double* out)
+{
+    return inverse(&ElectronPositronEOS<real_t, deriv_level>::try_pe_state_from_p,
+                   rho, p, Ye, temp_guess, out);
+}
+
+int eleceos_pe_state_from_s(double rho, double s, double Ye, double temp_guess, double* out)
+{
+    return inverse(&ElectronPositronEOS<real_t, deriv_level>::try_pe_state_from_s,
+                   rho, s, Ye, temp_guess, out);
+}
+
+size_t eleceos_pe_state_from_e_batch(size_t npts, const double* rho, const double* e,
+                                     const double* Ye, const double* temp_guess,
+                                     double* out, int* status)
+{
+    return batch(npts, ELECEOS_STATE_SIZE, out, status,
+                 [=] (std::size_t i, double* o) {
+                     return eleceos_pe_state_from_e(rho[i], e[i], Ye[i], temp_guess[i], o); });
+}
+
+size_t eleceos_pe_state_from_p_batch(size_t npts, const double* rho, const double* p,
+                                     const double* Ye, const double* temp_guess,
+                                     double* out, int* status)
+{
+    return batch(npts, ELECEOS_STATE_SIZE, out, status,
+                 [=] (std::size_t i, double* o) {
+                     return eleceos_pe_state_from_p(rho[i], p[i], Ye[i], temp_guess[i], o); });
+}
+
+size_t eleceos_pe_state_from_s_batch(size_t npts, const double* rho, const double* s,
+                                     const double* Ye, const double* temp_guess,
+                                     double* out, int* status)
+{
+    return batch(npts, ELECEOS_STATE_SIZE, out, status,
+                 [=] (std::size_t i, double* o) {
+                     return eleceos_pe_state_from_s(rho[i], s[i], Ye[i], temp_guess[i], o); });
+}
+
+}
@@ -0,0 +1,128 @@
+#ifndef ELECEOS_H
+#define ELECEOS_H
+
+/*
+ * C interface to the electron-positron EOS, for linking into C and
+ * Fortran codes (see eleceos.F90 for the Fortran bindings).
+ *
+ * All inputs and outputs are doubles in caller-owned arrays.
+ * Internally, the EOS is evaluated in the precision the library was
+ * built with (PRECISION=...) and the results are rounded to double.
+ *
+ * A state is returned as a record of ELECEOS_STATE_SIZE doubles,
+ * indexed by eleceos_state_index, holding the totals (electrons +
+ * positrons) and their first derivatives.  The Helmholtz free energy
+ * terms are a record of ELECEOS_HELMHOLTZ_SIZE doubles.  For the
+ * batched calls, the records for consecutive points are contiguous.
+ *
+ * Every call returns a status code (for the batched calls, the
+ * number of points that failed, with the per-point codes in status,
+ * which may be NULL).  The output for a point that failed is set to
+ * zero.  The batched calls are spread over OpenMP threads.
+ */
+
+#include <stddef.h>
+
+#if defined(__GNUC__)
+#define ELECEOS_EXPORT __attribute__((visibility("default")))
+#else
+#define ELECEOS_EXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* status codes -- the same as EOSStatus */
+
+enum eleceos_status {
+    ELECEOS_SUCCESS = 0,
+    ELECEOS_ROOT_NOT_BRACKETED = 1,
+    ELECEOS_MAX_ITERATIONS = 2,
+    ELECEOS_OUT_OF_TABLE = 3,
+    ELECEOS_ETA_SOLVE_FAILED = 4,
+    ELECEOS_TEMP_SOLVE_FAILED = 5
+};
+
+enum eleceos_state_index {
+    ELECEOS_RHO = 0,
+    ELECEOS_TEMP,
+    ELECEOS_YE,
+    ELECEOS_ETA,
+    ELECEOS_BETA,
+    ELECEOS_N,
+    ELECEOS_P,
+    ELECEOS_E,
+    ELECEOS_S,
+    ELECEOS_DETA_DRHO,
+    ELECEOS_DETA_DT,
+    ELECEOS_DN_DRHO,
+    ELECEOS_DN_DT,
+    ELECEOS_DP_DRHO,
+    ELECEOS_DP_DT,
+    ELECEOS_DE_DRHO,
+    ELECEOS_DE_DT,
+    ELECEOS_DS_DRHO,
+    ELECEOS_DS_DT,
+    ELECEOS_STATE_SIZE
+};
+
+enum eleceos_helmholtz_index {
+    ELECEOS_F = 0,
+    ELECEOS_DF_DRHO,
+    ELECEOS_DF_DT,
+    ELECEOS_D2F_DRHO2,
+    ELECEOS_D2F_DT2,
+    ELECEOS_D2F_DRHODT,
+    ELECEOS_D3F_DRHODT2,
+    ELECEOS_D3F_DRHO2DT,
+    ELECEOS_D4F_DRHO2DT2,
+    ELECEOS_HELMHOLTZ_SIZE
+};
+
+/* a description of a status code */
+ELECEOS_EXPORT const char* eleceos_status_message(int status);
+
+/* the number of bits in the mantissa of the internal precision */
+ELECEOS_EXPORT int eleceos_precision_digits(void);
+
+/* the state at (rho, temp, Ye) */
+ELECEOS_EXPORT int eleceos_pe_state(double rho, double temp, double Ye, double* state);
+
+ELECEOS_EXPORT size_t eleceos_pe_state_batch(size_t npts, const double* rho, const double* temp,
+                                             const double* Ye, double* state, int* status);
+
+/* the Helmholtz free energy and its derivatives, as tabulated by helmeos */
+ELECEOS_EXPORT int eleceos_helmholtz(double rho, double temp, double Ye, double* helm);
+
+ELECEOS_EXPORT size_t eleceos_helmholtz_batch(size_t npts, const double* rho, const double* temp,
+                                              const double* Ye, double* helm, int* status);
+
+/* just the degeneracy parameter η */
+ELECEOS_EXPORT int eleceos_get_eta(double rho, double temp, double Ye, double* eta);
+
+ELECEOS_EXPORT size_t eleceos_get_eta_batch(size_t npts, const double* rho, const double* temp,
+                                            const double* Ye, double* eta, int* status);
+
+/* the state with the given specific internal energy, pressure, or
+   specific entropy at density rho (the temperature is in
+   state[ELECEOS_TEMP]), starting the search from temp_guess */
+ELECEOS_EXPORT int eleceos_pe_state_from_e(double rho, double e, double Ye, double temp_guess, double* state);
+ELECEOS_EXPORT int eleceos_pe_state_from_p(double rho, double p, double Ye, double temp_guess, double* state);
+ELECEOS_EXPORT int eleceos_pe_state_from_s(double rho, double s, double Ye, double temp_guess, double* state);
+
+ELECEOS_EXPORT size_t eleceos_pe_state_from_e_batch(size_t npts, const double* rho, const double* e,
+                                                    const double* Ye, const double* temp_guess,
+                                                    double* state, int* status);
+ELECEOS_EXPORT size_t eleceos_pe_state_from_p_batch(size_t npts, const double* rho, const double* p,
+                                                    const double* Ye, const double* temp_guess,
+                                                    double* state, int* status);
+ELECEOS_EXPORT size_t eleceos_pe_state_from_s_batch(size_t npts, const double* rho, const double* s,
+                                                    const double* Ye, const double* temp_guess,
+                                                    double* state, int* status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,131 @@
+/*
+ * Exercise the C interface: compare the single and batched calls,
+ * check that the inverse calls recover the temperature, and check
+ * that failures are reported.
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "eleceos.h"
+
+#define NPTS 6
+
+static int n_failed_checks = 0;
+
+static void check(int passed, const char* what)
+{
+    if (passed) {
+        printf("\033[92m%s: passed\033[0m\n", what);
+    } else {
+        printf("\033[91m%s: failed\033[0m\n", what);
+        ++n_failed_checks;
+    }
+}
+
+int main(void)
+{
+    const double rho[NPTS] = {1.e-2, 1.e2, 1.e5, 1.e7, 1.e9, 1.e5};
+    const double temp[NPTS] = {1.e9, 1.e7, 1.e8, 1.e6, 5.e9, 1.e8};
+    const double Ye[NPTS] = {0.5, 0.5, 0.5, 0.5, 0.5, 0.4};
+
+    double state[NPTS][ELECEOS_STATE_SIZE];
+    double helm[NPTS][ELECEOS_HELMHOLTZ_SIZE];
+    double eta[NPTS];
+    int status[NPTS];
+
+    printf("internal precision: %d bits\n", eleceos_precision_digits());
+
+    /* the batched calls agree exactly with the single-point calls */
+
+    size_t n_failed = eleceos_pe_state_batch(NPTS, rho, temp, Ye, &state[0][0], status);
+    check(n_failed == 0, "pe_state_batch");
+
+    int same = 1;
+    for (int i = 0; i < NPTS; ++i) {
+        double single[ELECEOS_STATE_SIZE];
+        same = same && eleceos_pe_state(rho[i], temp[i], Ye[i], single) == ELECEOS_SUCCESS &&
+            memcmp(single, state[i], sizeof(single)) == 0 && status[i] == ELECEOS_SUCCESS;
+    }
+    check(same, "pe_state_batch agrees with pe_state");
+
+    n_failed = eleceos_get_eta_batch(NPTS, rho, temp, Ye, eta, status);
+    same = n_failed == 0;
+    for (int i = 0; i < NPTS; ++i) {
+        same = same && eta[i] == state[i][ELECEOS_ETA];
+    }
+    check(same, "get_eta_batch agrees with the state");
+
+    /* F = e - T s */
+
+    n_failed = eleceos_helmholtz_batch(NPTS, rho, temp, Ye, &helm[0][0], status);
+    same = n_failed == 0;
+    for (int i = 0; i < NPTS; ++i) {
+        const double F = state[i][ELECEOS_E] - temp[i] * state[i][ELECEOS_S];
+        same = same && fabs(helm[i][ELECEOS_F] - F) <= 1.e-10 * fabs(state[i][ELECEOS_E]) &&
+            helm[i][ELECEOS_DF_DT] == -state[i][ELECEOS_S];
+    }
+    check(same, "helmholtz_batch agrees with the state");
+
+    /* the inverse calls recover the inverted quantity, starting from
+       a temperature guess that is off by a factor of 2 above or 0.3
+       below (in degenerate matter, e and p barely depend on T, so we
+       don't compare the temperature itself).  The tolerance allows
+       for the cancellation in s for degenerate matter at double
+       precision. */
+
+    double e[NPTS];
+    double p[NPTS];
+    double s[NPTS];
+    for (int i = 0; i < NPTS; ++i) {
+        e[i] = state[i][ELECEOS_E];
+        p[i] = state[i][ELECEOS_P];
+        s[i] = state[i][ELECEOS_S];
+    }
+
+    double inv[NPTS][ELECEOS_STATE_SIZE];
+
+    const char* names[3] = {"pe_state_from_e_batch", "pe_state_from_p_batch", "pe_state_from_s_batch"};
+    const int index[3] = {ELECEOS_E, ELECEOS_P, ELECEOS_S};
+    const double guess_factors[2] = {2.0, 0.3};
+
+    for (int g = 0; g < 2; ++g) {
+        double T_guess[NPTS];
+        for (int i = 0; i < NPTS; ++i) {
+            T_guess[i] = guess_factors[g] * temp[i];
+        }
+
+        for (int n = 0; n < 3; ++n) {
+            if (n == 0) {
+                n_failed = eleceos_pe_state_from_e_batch(NPTS, rho, e, Ye, T_guess, &inv[0][0], status);
+            } else if (n == 1) {
+                n_failed = eleceos_pe_state_from_p_batch(NPTS, rho, p, Ye, T_guess, &inv[0][0], status);
+            } else {
+                n_failed = eleceos_pe_state_from_s_batch(NPTS, rho, s, Ye, T_guess, &inv[0][0], status);
+            }
+            same = n_failed == 0;
+            for (int i = 0; i < NPTS; ++i) {
+                const double target = state[i][index[n]];
+                same = same && fabs(inv[i][index[n]] - target) <= 1.e-8 * fabs(target);
+            }
+
+            char what[64];
+            snprintf(what, sizeof(what), "%s, guess %.1f T", names[n], guess_factors[g]);
+            check(same, what);
+        }
+    }
+
+    /* a failure is flagged and zeroes the output */
+
+    double bad[ELECEOS_STATE_SIZE];
+    const int bad_status = eleceos_pe_state(1.0, NAN, 0.5, bad);
+    int zeroed = 1;
+    for (int i = 0; i < ELECEOS_STATE_SIZE; ++i) {
+        zeroed = zeroed && bad[i] == 0.0;
+    }
+    printf("invalid temperature: %s\n", eleceos_status_message(bad_status));
+    check(bad_status != ELECEOS_SUCCESS && zeroed, "failure is reported");
+
+    return n_failed_checks;
+}
@@ -43,3 +43,23 @@ make PRECISION=FLOAT128 QUAD_PTS=400
 make clean
 make PRECISION=FLOAT128 QUAD_PTS=800
 ./generate_maxwell_data
+
+# compensated summation (and double-double, which needs it least)
+
+make clean
+make PRECISION=DOUBLE QUAD_PTS=200 COMPENSATED_SUM=TRUE
+./generate_maxwell_data
+
+for q in 100 200 400; do
+    make clean
+    make PRECISION=LONG_DOUBLE QUAD_PTS=$q COMPENSATED_SUM=TRUE
+    ./generate_maxwell_data
+
+    make clean
+    make PRECISION=DD QUAD_PTS=$q COMPENSATED_SUM=TRUE
+    ./generate_maxwell_data
+done
+
+make clean
+make PRECISION=DD QUAD_PTS=200
+./generate_maxwell_data
@@ -6,6 +6,7 @@
 #include "real_type.H"
 #include "mp_math.H"
 #include "maxwell_relations.H"
+#include "eos_cache.H"
 #include "util.H"
 
 struct MaxwellError {
@@ -56,15 +57,29 @@ auto main() -> int
     precision = "256";
 #elif defined(USE_FLOAT128)
     precision = "128";
+#elif defined(USE_QD)
+    precision = "qd";
+#elif defined(USE_DD)
+    precision = "dd";
 #elif defined(USE_LONG_DOUBLE)
     precision = "80";
 #else
     precision = "64";
 #endif
 
+#if defined(USE_COMPENSATED_SUM)
+    precision += "_compensated";
+#endif
+
 
     std::vector<MaxwellError> max_err(Ts.size() * rhos.size());
 
+    // all three relations share one state per point.  States computed
+    // in a previous run (e.g., at another precision of the plot) are
+    // reused if EOS_CACHE_DIR is set.
+
+    auto cache = EOSCache<EOSState<real_t, 1>>::from_environment("EOSState<1>", 0);
+
     #pragma omp parallel for collapse(2)
     for (int it = 0; it < static_cast<int>(Ts.size()); ++it) {
         for (int ir = 0; ir < static_cast<int>(rhos.size()); ++ir) {
@@ -74,9 +89,13 @@ auto main() -> int
 
             const int idx = it * rhos.size() + ir;
 
-            auto [scale1, error1] = maxwell_1<real_t>(rho, T, Ye);
-            auto [scale2, error2] = maxwell_2<real_t>(rho, T, Ye);
-            auto [scale3, error3] = maxwell_3<real_t>(rho, T, Ye);
+            ElectronPositronEOS<real_t, 1> eos;
+            auto es = value_or_throw(cache.get_or_compute(rho, T, Ye,
+                                                          [&] { return eos.try_pe_state(rho, T, Ye); }));
+
+            auto [scale1, error1] = maxwell_1(es);
+            auto [scale2, error2] = maxwell_2(es);
+            auto [scale3, error3] = maxwell_3(es);
 
             max_err[idx].rho = rho;
             max_err[idx].T = T;
@@ -0,0 +1,115 @@
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "real_type.H"
+#include "adaptive_precision.H"
+#include "electron_positron.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto main() -> int
+{
+
+#if defined(USE_BOOST256) || defined(USE_FLOAT128) || defined(USE_LONG_DOUBLE) || defined(USE_DD) || defined(USE_QD) || \
+    defined(USE_COUNTING)
+
+    // the cheaper types can't be narrower than real_t
+
+    util::println("adaptive precision needs real_t = double, skipping");
+
+#elif defined(USE_CANCELLATION_FREE)
+
+    // n⁻ - n⁺ is integrated directly, so even the state near the pair
+    // threshold is accurate in double
+
+    AdaptivePrecision<real_t, double, long double> adaptive(1.e-12);
+
+    const auto hard = adaptive.try_pe_state(1.e-2_rt, 5.e9_rt, 0.5_rt);
+    const auto c = adaptive.counts();
+    util::println("accepted: {} in {}, {} in {}", c[0].second, c[0].first, c[1].second, c[1].first);
+
+    check(hard && c[0].second == 1, "pair threshold state in double");
+
+#else
+
+    // double first, then long double (real_t is the output)
+
+    using Adaptive = AdaptivePrecision<real_t, double, long double>;
+
+    const real_t Ye{0.5_rt};
+
+    // a hot, mildly degenerate state, where double is plenty, and a
+    // state near the pair threshold, where n⁻ - n⁺ cancels badly
+
+    const real_t rho_easy{1.e5_rt};
+    const real_t T_easy{1.e8_rt};
+
+    const real_t rho_hard{1.e-2_rt};
+    const real_t T_hard{5.e9_rt};
+
+    ElectronPositronEOS<double, 3> eos_d;
+    ElectronPositronEOS<long double, 3> eos_ld;
+
+    const auto easy_d = eos_d.try_pe_state(static_cast<double>(rho_easy), static_cast<double>(T_easy), static_cast<double>(Ye));
+    const auto hard_d = eos_d.try_pe_state(static_cast<double>(rho_hard), static_cast<double>(T_hard), static_cast<double>(Ye));
+    const auto hard_ld = eos_ld.try_pe_state(static_cast<long double>(rho_hard), static_cast<long double>(T_hard),
+                                             static_cast<long double>(Ye));
+
+    check(easy_d && hard_d && hard_ld, "states");
+
+    const double err_easy = error_estimate(*easy_d);
+    const double err_hard = error_estimate(*hard_d);
+    const double err_hard_ld = error_estimate(*hard_ld);
+
+    util::println("error estimates: easy state {:.3g}, hard state {:.3g} (double), {:.3g} (long double)",
+                  err_easy, err_hard, err_hard_ld);
+
+    check(err_easy < 1.e-12 && err_hard > 1.e-10 && err_hard_ld < err_hard,
+          "error estimate");
+
+    // a tolerance between the two sends only the hard state to long
+    // double
+
+    Adaptive adaptive(1.e-12);
+
+    const auto easy = adaptive.try_pe_state(rho_easy, T_easy, Ye);
+    const auto hard = adaptive.try_pe_state(rho_hard, T_hard, Ye);
+
+    const auto c = adaptive.counts();
+    util::println("accepted: {} in {}, {} in {}", c[0].second, c[0].first, c[1].second, c[1].first);
+
+    check(easy && hard && c[0].second == 1 && c[1].second == 1, "escalation");
+
+    check(easy->p == static_cast<real_t>(easy_d->p) &&
+          easy->d3s_dT3 == static_cast<real_t>(easy_d->d3s_dT3) &&
+          hard->p == static_cast<real_t>(hard_ld->p) &&
+          hard->d3eta_drho3 == static_cast<real_t>(hard_ld->d3eta_drho3) &&
+          hard->n_pos == static_cast<real_t>(hard_ld->n_pos),
+          "results match the type they were accepted in");
+
+    // the Helmholtz table entries
+
+    Adaptive table(1.e-12);
+    const auto entry = table.try_helmholtz_entry(rho_hard, T_hard, Ye);
+    const auto entry_ld = try_get_helmholtz_entry(static_cast<long double>(rho_hard), static_cast<long double>(T_hard),
+                                                  static_cast<long double>(Ye));
+
+    check(entry && entry_ld && table.counts()[1].second == 1 &&
+          entry->helm.F == static_cast<real_t>(entry_ld->helm.F) &&
+          entry->totals.d2eta_drhodT == static_cast<real_t>(entry_ld->totals.d2eta_drhodT),
+          "Helmholtz entry");
+
+    // converting a state and back
+
+    const auto round_trip = state_cast<double>(state_cast<long double>(*easy_d));
+    check(round_trip.p == easy_d->p && round_trip.dse_drho == easy_d->dse_drho &&
+          round_trip.d3np_dT3 == easy_d->d3np_dT3,
+          "state conversion");
+
+#endif
+
+    return checks_status();
+}
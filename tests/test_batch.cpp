@@ -0,0 +1,90 @@
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <mdspan>
+#include <vector>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "util.H"
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+using namespace literals;
+
+// a zone of a hydro code stored as an array of structs
+
+struct Zone {
+    real_t rho;
+    real_t T;
+    real_t Ye;
+    real_t p;
+    real_t e;
+};
+
+auto main() -> int
+{
+
+    // evaluate the EOS on a batch of zones, reading (ρ, T, Yₑ) and
+    // writing (p, e) directly into the zone structs via strided
+    // views, and writing ∂p/∂T into a separate array.  The last zone
+    // has an invalid temperature, which should be flagged.
+
+    std::vector<Zone> zones;
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+            zones.push_back({rho, T, 0.5_rt, 0.0_rt, 0.0_rt});
+        }
+    }
+    zones.push_back({1.0_rt, std::numeric_limits<real_t>::quiet_NaN(), 0.5_rt, 0.0_rt, 0.0_rt});
+
+    const std::size_t npts = zones.size();
+
+    auto view = [&] (real_t Zone::* member) -> BatchOutput<real_t>
+    {
+        // a view of one member of each zone
+        constexpr std::size_t stride = sizeof(Zone) / sizeof(real_t);
+        return {&(zones[0].*member),
+                {std::dextents<std::size_t, 1>(npts), std::array<std::size_t, 1>{stride}}};
+    };
+
+    std::vector<real_t> dp_dT(npts);
+    std::vector<EOSStatus> status(npts);
+
+    const std::array<BatchField<real_t, 1>, 3> fields{{
+        {&EOSState<real_t>::p, view(&Zone::p)},
+        {&EOSState<real_t>::e, view(&Zone::e)},
+        {&EOSState<real_t>::dp_dT, std::mdspan(dp_dT.data(), npts)}}};
+
+    ElectronPositronEOS<real_t, 1> eos;
+
+    auto n_failed = eos.pe_state_batch(view(&Zone::rho), view(&Zone::T), view(&Zone::Ye),
+                                       fields, std::mdspan(status.data(), npts));
+
+    util::println("number of failed points = {}", n_failed);
+
+    // compare to calling the EOS one point at a time
+
+    for (std::size_t i = 0; i < npts; ++i) {
+        const auto& z = zones[i];
+        auto es = eos.try_pe_state(z.rho, z.T, z.Ye);
+
+        bool same{};
+        if (es) {
+            same = status[i] == EOSStatus::success &&
+                z.p == es->p && z.e == es->e && dp_dT[i] == es->dp_dT;
+        } else {
+            same = status[i] == es.error() &&
+                z.p == 0.0_rt && z.e == 0.0_rt && dp_dT[i] == 0.0_rt;
+        }
+
+        if (same) {
+            util::green_println("ρ = {:8.3g} T = {:8.3g}: p = {:15.8g}  e = {:15.8g}  ∂p/∂T = {:15.8g}  ({})",
+                                z.rho, z.T, z.p, z.e, dp_dT[i], status_message(status[i]));
+        } else {
+            util::red_println("ρ = {:8.3g} T = {:8.3g}: batch and single-point results differ",
+                              z.rho, z.T);
+        }
+    }
+}
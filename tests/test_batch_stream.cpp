@@ -0,0 +1,123 @@
+#include <array>
+#include <cstring>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "batch_stream.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+using State = EOSState<real_t, 1>;
+
+const std::array<batch_stream::Column<State>, 2> columns{{
+    {"p", &State::p},
+    {"dp_dT", &State::dp_dT}}};
+
+auto main() -> int
+{
+
+    // stream a set of records through the batch machinery with a
+    // look-ahead smaller than the number of records, and check that
+    // the output is in the input order and matches evaluating each
+    // record directly.  The second-to-last record fails.
+
+    ElectronPositronEOS<real_t, 1> eos;
+    auto evaluate = [&] (real_t rho, real_t T, real_t Ye) { return eos.try_pe_state(rho, T, Ye); };
+
+    const std::vector<batch_stream::Record> records{
+        {1.e-2, 1.e9, 0.5}, {1.e2, 1.e7, 0.5}, {1.e5, 1.e8, 0.5},
+        {1.e7, 1.e6, 0.5}, {1.e9, 5.e9, 0.5}, {1.0, -1.0, 0.5}, {1.e5, 1.e8, 0.4}};
+
+    std::string text = "# rho T Ye\n\n";
+    for (const auto& r : records) {
+        text += std::format("{} {}, {}\n", r.rho, r.temp, r.Ye);
+    }
+
+    // the expected CSV
+
+    std::string expected = "rho,T,Ye,status,p,dp_dT\n";
+    for (const auto& r : records) {
+        auto es = evaluate(static_cast<real_t>(r.rho), static_cast<real_t>(r.temp), static_cast<real_t>(r.Ye));
+        expected += std::format("{:.17g},{:.17g},{:.17g},{},{:.17g},{:.17g}\n",
+                                r.rho, r.temp, r.Ye, es ? 0 : static_cast<int>(es.error()),
+                                es ? static_cast<double>(es->p) : 0.0,
+                                es ? static_cast<double>(es->dp_dT) : 0.0);
+    }
+
+    {
+        std::istringstream in(text);
+        std::ostringstream out;
+
+        batch_stream::TextReader reader(in);
+        batch_stream::Writer<State> writer(out, batch_stream::Format::csv, columns);
+        auto n_failed = batch_stream::run(reader, evaluate, writer, 3);
+
+        check(out.str() == expected && n_failed == 1, "text input, CSV output");
+    }
+
+    // binary input and output
+
+    const auto path = std::filesystem::temp_directory_path() / std::format("batch_stream_test_{}.bin", getpid());
+    {
+        std::ofstream f(path, std::ios::binary);
+        for (const auto& r : records) {
+            const std::array<double, 3> v{r.rho, r.temp, r.Ye};
+            f.write(reinterpret_cast<const char*>(v.data()), sizeof(v));
+        }
+    }
+
+    {
+        batch_stream::BinaryReader reader(path.string());
+        std::ostringstream out;
+        batch_stream::Writer<State> writer(out, batch_stream::Format::binary, columns);
+        auto n_failed = batch_stream::run(reader, evaluate, writer, 2);
+
+        const std::string bytes = out.str();
+        std::vector<double> rows(bytes.size() / sizeof(double));
+        std::memcpy(rows.data(), bytes.data(), rows.size() * sizeof(double));
+
+        bool same = n_failed == 1 && rows.size() == records.size() * 6;
+        for (std::size_t i = 0; same && i < records.size(); ++i) {
+            auto es = evaluate(static_cast<real_t>(records[i].rho), static_cast<real_t>(records[i].temp),
+                               static_cast<real_t>(records[i].Ye));
+            const double* row = rows.data() + 6 * i;
+            same = row[0] == records[i].rho && row[1] == records[i].temp && row[2] == records[i].Ye &&
+                row[3] == (es ? 0.0 : static_cast<double>(es.error())) &&
+                row[4] == (es ? static_cast<double>(es->p) : 0.0) &&
+                row[5] == (es ? static_cast<double>(es->dp_dT) : 0.0);
+        }
+
+        check(same, "binary input, binary output");
+    }
+
+    std::filesystem::remove(path);
+
+    // a malformed line is reported with its line number
+
+    {
+        std::istringstream in("1.e5 1.e8 0.5\n1.e5 1.e8\n");
+        std::ostringstream out;
+        batch_stream::TextReader reader(in);
+        batch_stream::Writer<State> writer(out, batch_stream::Format::csv, columns);
+
+        std::string message;
+        try {
+            batch_stream::run(reader, evaluate, writer, 4);
+        } catch (const std::runtime_error& e) {
+            message = e.what();
+        }
+        check(message == "line 2: expected rho T Ye", "malformed input");
+    }
+
+    return checks_status();
+}
@@ -0,0 +1,96 @@
+#include <array>
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "eos_batcher.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+auto main() -> int
+{
+
+    // several threads each submit every (ρ, T) point one at a time,
+    // and we check that the results through the batcher are the same
+    // as calling the EOS directly.  A large timeout means that the
+    // batches are only run when full (or by the destructor).
+
+    const real_t Ye{0.5_rt};
+    constexpr int nthreads{4};
+    constexpr std::size_t batch_size{8};
+
+    ElectronPositronEOS<real_t, 1> eos;
+
+    bool same{true};
+    std::size_t n_batches{};
+
+    {
+        EOSBatcher<real_t, 1> batcher(batch_size, std::chrono::seconds{10});
+
+        std::vector<std::vector<std::future<EOSBatcher<real_t, 1>::Result>>> futures(nthreads);
+        std::vector<std::thread> threads;
+        for (int n = 0; n < nthreads; ++n) {
+            threads.emplace_back([&, n] {
+                for (auto T : Ts) {
+                    for (auto rho : rhos) {
+                        futures[n].push_back(batcher.submit(rho, T, Ye));
+                    }
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        // 4 threads x 16 points fill exactly 8 batches
+
+        for (auto& fs : futures) {
+            std::size_t i{};
+            for (auto T : Ts) {
+                for (auto rho : rhos) {
+                    auto es = fs[i++].get();
+                    auto ref = eos.try_pe_state(rho, T, Ye);
+                    same = same && es && ref && es->p == ref->p && es->dp_dT == ref->dp_dT &&
+                        es->s == ref->s && es->eta == ref->eta;
+                }
+            }
+        }
+        n_batches = batcher.batches_run();
+
+        check(batcher.states_run() == nthreads * Ts.size() * rhos.size(), "every state evaluated");
+    }
+
+    check(same, "batched results match the direct calls");
+    check(n_batches == nthreads * Ts.size() * rhos.size() / batch_size, "states grouped into full batches");
+
+    // a lone submission is run once the timeout expires
+
+    {
+        EOSBatcher<real_t, 1> batcher(batch_size, std::chrono::milliseconds{1});
+        auto es = batcher.try_pe_state(1.e5_rt, 1.e8_rt, Ye);
+        auto ref = eos.try_pe_state(1.e5_rt, 1.e8_rt, Ye);
+        check(es && ref && es->p == ref->p && batcher.batches_run() == 1, "timeout flushes a partial batch");
+    }
+
+    // flush() and failures
+
+    {
+        EOSBatcher<real_t, 1> batcher(batch_size, std::chrono::seconds{10});
+        auto good = batcher.submit(1.e5_rt, 1.e8_rt, Ye);
+        auto bad = batcher.submit(1.0_rt, -1.0_rt, Ye);
+        batcher.flush();
+        auto es_good = good.get();
+        auto es_bad = bad.get();
+        check(es_good && !es_bad && batcher.batches_run() == 1, "flush runs a partial batch");
+    }
+
+    return checks_status();
+}
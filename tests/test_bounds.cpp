@@ -1,5 +1,4 @@
 #include <array>
-#include <stdexcept>
 
 #include "brent.H"
 #include "degeneracy_parameter_bounds.H"
@@ -21,22 +20,28 @@ auto main() -> int
     for (auto T : Ts) {
         for (auto rho : rhos) {
 
-            auto [eta_min, eta_max] = bounds::get_eta_bounds(rho * Ye, T);
+            auto eta_bounds = bounds::get_eta_bounds(rho * Ye, T);
+
+            if (!eta_bounds) {
+                util::red_println("bounds failed for rho = {:8.3g}, T = {:8.3g}", rho, T);
+                continue;
+            }
+
+            auto [eta_min, eta_max] = *eta_bounds;
 
-            real_t eta{};
             const real_t beta = C::dbeta_dT * T;
             const real_t n_e_net = rho * Ye * C::N_A;
 
-            try {
-                eta = brent<real_t>([=] (real_t _eta) -> real_t
-                    {
-                        auto n_e = n_e_constraint(_eta, beta);
-                        auto n_pos = n_p_constraint(_eta, beta);
-                        return n_e_net - (n_e - n_pos);
-                    }, eta_min, eta_max);
-                util::green_println("bounds passed for rho = {:8.3g}, T = {:8.3g}; eta = {:9.2f}", rho, T, eta);
+            auto eta = brent<real_t>([=] (real_t _eta) -> real_t
+                {
+                    auto n_e = n_e_constraint(_eta, beta);
+                    auto n_pos = n_p_constraint(_eta, beta);
+                    return n_e_net - (n_e - n_pos);
+                }, eta_min, eta_max);
 
-            } catch (const std::out_of_range& e) {
+            if (eta) {
+                util::green_println("bounds passed for rho = {:8.3g}, T = {:8.3g}; eta = {:9.2f}", rho, T, *eta);
+            } else {
                 util::red_println("bounds failed for rho = {:8.3g}, T = {:8.3g}", rho, T);
             }
         }
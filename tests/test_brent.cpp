@@ -14,5 +14,5 @@ auto main() -> int
                           {return (x + 3.0_rt) * mp::pow(x - 1.0_rt, 2);},
         a, b);
 
-    util::println("root = {}", r);
+    util::println("root = {}", r.value());
 }
@@ -0,0 +1,100 @@
+#include <filesystem>
+#include <format>
+#include <limits>
+
+#include <unistd.h>
+
+#include "real_type.H"
+#include "eos_types.H"
+#include "electron_positron.H"
+#include "eos_cache.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto same_state(const EOSState<real_t>& a, const EOSState<real_t>& b) -> bool
+{
+    return a.rho == b.rho && a.temp == b.temp && a.p == b.p && a.eta == b.eta &&
+        a.s_pos == b.s_pos && a.d3p_dT3 == b.d3p_dT3 && a.d3eta_dT3 == b.d3eta_dT3;
+}
+
+auto main() -> int
+{
+
+    // the on-disk store goes in a scratch directory that we remove at
+    // the end
+
+    const auto dir = std::filesystem::temp_directory_path() / std::format("eos_cache_test_{}", getpid());
+    std::filesystem::remove_all(dir);
+
+    const real_t Ye{0.5_rt};
+
+    ElectronPositronEOS<real_t> eos;
+
+    const real_t rho{1.e5_rt};
+    const real_t T{1.e8_rt};
+    const auto es = eos.pe_state(rho, T, Ye);
+
+    {
+        EOSCache<EOSState<real_t>> cache("EOSState<3>", 16, dir.string());
+        check(cache.disk_enabled(), "open the on-disk store");
+
+        // the first call computes the state, the second is a memory hit
+
+        int ncomputed{0};
+        auto compute = [&] { ++ncomputed; return eos.try_pe_state(rho, T, Ye); };
+
+        auto s1 = cache.get_or_compute(rho, T, Ye, compute);
+        auto s2 = cache.get_or_compute(rho, T, Ye, compute);
+
+        check(s1 && s2 && same_state(*s1, es) && same_state(*s2, es) && ncomputed == 1 &&
+              cache.memory_hits == 1 && cache.misses == 1, "memory hit");
+
+        // a nearby (but different) ρ is a different entry
+
+        auto s3 = cache.find(rho * (1.0_rt + std::numeric_limits<real_t>::epsilon()), T, Ye);
+        check(!s3, "neighboring ρ misses");
+
+        // states that are not finite are never cached
+
+        const real_t nan = std::numeric_limits<real_t>::quiet_NaN();
+        cache.insert(nan, T, Ye, es);
+        check(!cache.find(nan, T, Ye), "NaN key is not cached");
+
+        // fill the store past its initial capacity (so it has to grow),
+        // and push everything but the last 16 out of memory.  We just
+        // need distinct values here, so we don't call the EOS.
+
+        for (int i = 0; i < 3000; ++i) {
+            EOSState<real_t> fake{};
+            fake.rho = static_cast<real_t>(i);
+            cache.insert(static_cast<real_t>(i), T, Ye, fake);
+        }
+    }
+
+    {
+        // a second cache (e.g., the next run) finds everything on disk
+
+        EOSCache<EOSState<real_t>> cache("EOSState<3>", 16, dir.string());
+
+        auto s1 = cache.find(rho, T, Ye);
+        check(s1 && same_state(*s1, es) && cache.disk_hits == 1, "disk round trip");
+
+        bool all_found{true};
+        for (int i = 0; i < 3000; ++i) {
+            auto s = cache.find(static_cast<real_t>(i), T, Ye);
+            all_found = all_found && s && s->rho == static_cast<real_t>(i);
+        }
+        check(all_found, "grow the on-disk store");
+
+        // a different kind of result uses a different store
+
+        EOSCache<EOSState<real_t>> other("EOSState<3> other", 16, dir.string());
+        check(!other.find(rho, T, Ye), "separate store per build tag");
+    }
+
+    std::filesystem::remove_all(dir);
+
+    return checks_status();
+}
@@ -0,0 +1,157 @@
+#include <algorithm>
+#include <array>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+
+#include "real_type.H"
+#include "fermi_integrals.H"
+#include "fundamental_constants.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto relative_error(const real_t& a, const real_t& b) -> real_t
+{
+    return mp::abs(a - b) / mp::abs(b);
+}
+
+auto main() -> int
+{
+
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    const std::array<real_t, 5> etas{-30.0_rt, -5.0_rt, 0.0_rt, 3.0_rt, 30.0_rt};
+    const std::array<real_t, 3> betas{1.e-4_rt, 0.1_rt, 10.0_rt};
+
+    // the entropy integrals against the Fermi integrals they replace:
+    //
+    // Σ_{1/2} + β Σ_{3/2} = 5/3 F_{3/2} - η F_{1/2} + β (4/3 F_{5/2} - η F_{3/2})
+    //
+    // and the same for the η and β derivatives.  The right side
+    // cancels by about η², so the tolerance grows with η.
+
+    for (auto eta : etas) {
+        for (auto beta : betas) {
+
+            FermiIntegral<real_t> f12(0.5_rt, eta, beta);
+            FermiIntegral<real_t> f32(1.5_rt, eta, beta);
+            FermiIntegral<real_t> f52(2.5_rt, eta, beta);
+            FermiIntegral<real_t> s12(0.5_rt, eta, beta, Occupation::entropy);
+            FermiIntegral<real_t> s32(1.5_rt, eta, beta, Occupation::entropy);
+
+            for (auto* f : {&f12, &f32, &f52, &s12, &s32}) {
+                f->evaluate(1);
+            }
+
+            const real_t tol = 100.0_rt * eps * (1.0_rt + eta * eta);
+
+            const real_t S = s12.F + beta * s32.F;
+            const real_t S_fermi = (5.0_rt / 3.0_rt) * f32.F - eta * f12.F +
+                beta * ((4.0_rt / 3.0_rt) * f52.F - eta * f32.F);
+
+            const real_t dS_deta = s12.dF_deta + beta * s32.dF_deta;
+            const real_t dS_deta_fermi = (5.0_rt / 3.0_rt) * f32.dF_deta - f12.F - eta * f12.dF_deta +
+                beta * ((4.0_rt / 3.0_rt) * f52.dF_deta - f32.F - eta * f32.dF_deta);
+
+            const real_t dS_dbeta = s12.dF_dbeta + s32.F + beta * s32.dF_dbeta;
+            const real_t dS_dbeta_fermi = (5.0_rt / 3.0_rt) * f32.dF_dbeta - eta * f12.dF_dbeta +
+                (4.0_rt / 3.0_rt) * f52.F - eta * f32.F +
+                beta * ((4.0_rt / 3.0_rt) * f52.dF_dbeta - eta * f32.dF_dbeta);
+
+            const real_t err = std::max({relative_error(S, S_fermi),
+                                         relative_error(dS_deta, dS_deta_fermi),
+                                         relative_error(dS_dbeta, dS_dbeta_fermi)});
+
+            check(err < tol, std::format("entropy integral, η = {:g}, β = {:g} (error {:.3g})",
+                                         static_cast<double>(eta), static_cast<double>(beta),
+                                         static_cast<double>(err)));
+        }
+    }
+
+    // at high degeneracy, where the Fermi integral form has lost most
+    // of its digits, compare to the Sommerfeld expansion,
+    // Σ_{1/2} + β Σ_{3/2} ≈ (π²/3) η^{1/2} (1 + βη) (1 + βη/2)^{1/2},
+    // whose next term is ~1/η² smaller
+
+    {
+        const real_t eta{1.e5_rt};
+        const real_t beta{1.e-2_rt};
+
+        FermiIntegral<real_t> s12(0.5_rt, eta, beta, Occupation::entropy);
+        FermiIntegral<real_t> s32(1.5_rt, eta, beta, Occupation::entropy);
+        s12.evaluate(0);
+        s32.evaluate(0);
+
+        const real_t pi = constants::values<real_t>().pi;
+        const real_t sommerfeld = (pi * pi / 3.0_rt) * mp::sqrt(eta) * (1.0_rt + beta * eta) *
+            mp::sqrt(1.0_rt + 0.5_rt * beta * eta);
+
+        const real_t err = relative_error(s12.F + beta * s32.F, sommerfeld);
+        check(err < 1.e-8_rt, std::format("entropy integral at η = 1e5 (error {:.3g})",
+                                           static_cast<double>(err)));
+    }
+
+    // the net integrals and their first derivatives against the
+    // difference of the electron and positron Fermi integrals.  The
+    // error is relative to the sum, since the difference cancels when
+    // η ~ -1/β.  The two are integrated with different break points,
+    // so they only agree to the quadrature error.
+
+    for (auto eta : {-5.0_rt, -1.e-3_rt, 0.0_rt, 1.e-6_rt, 2.0_rt}) {
+        for (auto beta : betas) {
+
+            const real_t eta_tilde = -eta - 2.0_rt / beta;
+
+            FermiIntegral<real_t> f12(0.5_rt, eta, beta);
+            FermiIntegral<real_t> f32(1.5_rt, eta, beta);
+            FermiIntegral<real_t> f12_pos(0.5_rt, eta_tilde, beta);
+            FermiIntegral<real_t> f32_pos(1.5_rt, eta_tilde, beta);
+            FermiIntegral<real_t> f12_net(0.5_rt, eta, beta, Occupation::net);
+            FermiIntegral<real_t> f32_net(1.5_rt, eta, beta, Occupation::net);
+
+            for (auto* f : {&f12, &f32, &f12_pos, &f32_pos, &f12_net, &f32_net}) {
+                f->evaluate(1);
+            }
+
+            const real_t n_e = f12.F + beta * f32.F;
+            const real_t n_pos = f12_pos.F + beta * f32_pos.F;
+            const real_t n_net = f12_net.F + beta * f32_net.F;
+
+            const real_t err = mp::abs(n_net - (n_e - n_pos)) / (n_e + n_pos);
+
+            // n⁻ > n⁺ exactly when η > η̃
+
+            check(err < 1000.0_rt * eps && (n_net > 0.0_rt) == (eta > eta_tilde),
+                  std::format("net integral, η = {:g}, β = {:g} (error {:.3g})",
+                              static_cast<double>(eta), static_cast<double>(beta),
+                              static_cast<double>(err)));
+
+            // ∂η̃/∂η = -1 and ∂η̃/∂β = 2/β², and the β derivative of
+            // β F_3/2 also has F_3/2 itself
+
+            const real_t dn_net_deta = f12_net.dF_deta + beta * f32_net.dF_deta;
+            const real_t dn_e_deta = f12.dF_deta + beta * f32.dF_deta;
+            const real_t dn_pos_deta = f12_pos.dF_deta + beta * f32_pos.dF_deta;
+
+            const real_t err_eta = relative_error(dn_net_deta, dn_e_deta + dn_pos_deta);
+
+            const real_t dn_net_dbeta = f12_net.dF_dbeta + beta * f32_net.dF_dbeta + f32_net.F;
+            const real_t dn_e_dbeta = f12.dF_dbeta + beta * f32.dF_dbeta + f32.F;
+            const real_t dn_pos_dbeta = f12_pos.dF_dbeta + beta * f32_pos.dF_dbeta + f32_pos.F +
+                2.0_rt / (beta * beta) * dn_pos_deta;
+
+            const real_t err_beta = mp::abs(dn_net_dbeta - (dn_e_dbeta - dn_pos_dbeta)) /
+                (mp::abs(dn_e_dbeta) + mp::abs(dn_pos_dbeta));
+
+            check(err_eta < 1000.0_rt * eps && err_beta < 1000.0_rt * eps,
+                  std::format("net integral derivatives, η = {:g}, β = {:g} (errors {:.3g}, {:.3g})",
+                              static_cast<double>(eta), static_cast<double>(beta),
+                              static_cast<double>(err_eta), static_cast<double>(err_beta)));
+        }
+    }
+
+    return checks_status();
+}
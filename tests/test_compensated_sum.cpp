@@ -0,0 +1,59 @@
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "real_type.H"
+#include "compensated_sum.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+    const real_t big = 1.0_rt / (eps * eps);
+
+    // the classic failure of plain (and Kahan) summation: the small
+    // terms are lost next to a large one that later cancels
+
+    const std::vector<real_t> terms{1.0_rt, big, 1.0_rt, -big};
+
+    NeumaierSum<real_t> neumaier;
+    PlainSum<real_t> plain;
+    for (const auto& t : terms) {
+        neumaier += t;
+        plain += t;
+    }
+
+    check(neumaier.value() == 2.0_rt, "Neumaier sum with cancellation");
+    check(plain.value() == ((1.0_rt + big) + 1.0_rt) - big, "plain sum is in order");
+
+    // many terms that are each below an ulp of the running sum
+
+    const int n{100000};
+    const real_t tiny = 0.25_rt * eps;
+
+    NeumaierSum<real_t> many(1.0_rt);
+    for (int i = 0; i < n; ++i) {
+        many.add(tiny);
+    }
+
+    const real_t exact = 1.0_rt + static_cast<real_t>(n) * tiny;
+    check(mp::abs(many.value() - exact) <= eps * exact, "Neumaier sum of small terms");
+
+    // sum_terms adds in order, compensated only with USE_COMPENSATED_SUM
+
+    const real_t s = sum_terms<real_t>(1.0_rt, big, 1.0_rt, -big);
+
+#if defined(USE_COMPENSATED_SUM)
+    check(s == 2.0_rt, "sum_terms (compensated)");
+#else
+    check(s == plain.value(), "sum_terms (plain)");
+#endif
+
+    return checks_status();
+}
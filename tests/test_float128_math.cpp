@@ -0,0 +1,177 @@
+#include <format>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "real_type.H"
+#include "util.H"
+#include "checks.H"
+
+#if defined(EOS_HAVE_FLOAT128)
+#include "float128_math.H"
+#include "multi_double.H"
+#endif
+
+#if defined(EOS_HAVE_FLOAT128)
+
+using f128 = __float128;
+
+using multi_double::qd_real;
+
+// a __float128 as a quad-double (exactly)
+
+auto to_qd(const f128& x) -> qd_real
+{
+    const double x0 = static_cast<double>(x);
+    const double x1 = static_cast<double>(x - x0);
+    const double x2 = static_cast<double>(x - x0 - x1);
+    return qd_real{std::array<double, 4>{x0, x1, x2, 0.0}};
+}
+
+// the error in a compared to the exact value (computed in
+// quad-double), in units in the last place of a __float128
+
+auto ulps(const f128& a, const qd_real& exact) -> double
+{
+    const double e = static_cast<double>(exact);
+    if (e == 0.0) {
+        return a == 0 ? 0.0 : 1.e30;
+    }
+    const double ulp = std::ldexp(1.0, std::ilogb(e) - 112);
+    return std::abs(static_cast<double>(to_qd(a) - exact)) / ulp;
+}
+
+// the largest error of f and of the libquadmath function for n
+// arguments uniformly distributed in [lo, hi]
+
+template <typename F, typename Q, typename E>
+auto max_ulps(F f, Q libquadmath, E exact, double lo, double hi, int n = 5000) -> std::pair<double, double>
+{
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+
+    double worst{};
+    double worst_libquadmath{};
+    for (int i = 0; i < n; ++i) {
+        // fill in the low bits too, so the arguments aren't doubles
+        const f128 t = static_cast<f128>(u(gen)) + static_cast<f128>(u(gen)) * 0x1p-53;
+        const f128 x = lo + (hi - lo) * t;
+        const qd_real e = exact(to_qd(x));
+        worst = std::max(worst, ulps(f(x), e));
+        worst_libquadmath = std::max(worst_libquadmath, ulps(libquadmath(x), e));
+    }
+    return {worst, worst_libquadmath};
+}
+
+template <typename F, typename Q, typename E>
+void check_function(std::string_view name, F f, Q libquadmath, E exact,
+                    double lo, double hi, double tol)
+{
+    const auto [worst, worst_libquadmath] = max_ulps(f, libquadmath, exact, lo, hi);
+    check(worst <= tol,
+          std::format("{} on [{}, {}]: max error {:.3f} ulp (libquadmath {:.3f})",
+                      name, lo, hi, worst, worst_libquadmath));
+}
+
+#endif
+
+auto main() -> int
+{
+#if defined(EOS_HAVE_FLOAT128)
+
+    namespace fm = float128_math;
+    namespace md = multi_double;
+
+    // each function against the exact value, with libquadmath's error
+    // for comparison.  A correctly rounded result is within 0.5 ulp;
+    // exp gets that (to rounding in the last table lookup), and the
+    // others are within about the error of libquadmath's.
+
+    auto exp = [] (f128 x) { return fm::exp(x); };
+    auto exact_exp = [] (const qd_real& x) { return md::exp(x); };
+
+    check_function("exp", exp, expq, exact_exp, -1.0, 1.0, 0.51);
+    check_function("exp", exp, expq, exact_exp, -600.0, 600.0, 0.51);
+
+    // beyond the range of quad-double, just compare to libquadmath
+
+    int n_differ{};
+    for (int i = -11000; i <= 11000; i += 7) {
+        const f128 x = i + 0x1p-40Q * i;
+        if (fabsq(fm::exp(x) - expq(x)) > ldexpq(1.0Q, ilogbq(expq(x)) - 112)) {
+            ++n_differ;
+        }
+    }
+    check(n_differ == 0, "exp on [-11000, 11000]: within an ulp of libquadmath");
+
+    auto expm1 = [] (f128 x) { return fm::expm1(x); };
+    auto exact_expm1 = [] (const qd_real& x) { return md::exp(x) - 1.0; };
+
+    check_function("expm1", expm1, expm1q, exact_expm1, -0.01, 0.01, 1.5);
+    check_function("expm1", expm1, expm1q, exact_expm1, -50.0, 50.0, 1.5);
+
+    check_function("cosh", [] (f128 x) { return fm::cosh(x); }, coshq,
+                   [] (const qd_real& x) { return md::cosh(x); }, -50.0, 50.0, 1.5);
+
+    auto tanh = [] (f128 x) { return fm::tanh(x); };
+    auto exact_tanh = [] (const qd_real& x) { return md::tanh(x); };
+
+    check_function("tanh", tanh, tanhq, exact_tanh, -0.01, 0.01, 2.0);
+    check_function("tanh", tanh, tanhq, exact_tanh, -50.0, 50.0, 2.0);
+
+    auto log1p = [] (f128 x) { return fm::log1p(x); };
+    auto exact_log1p = [] (const qd_real& x) { return md::log1p(x); };
+
+    check_function("log1p", log1p, log1pq, exact_log1p, -0.5, 0.5, 2.0);
+    check_function("log1p", log1p, log1pq, exact_log1p, 0.0, 1.e10, 2.0);
+
+    // the exponents the Fermi kernels use
+
+    for (const double y : {0.5, 2.0, 3.5, 6.0, 7.5, -2.5}) {
+        check_function(std::format("pow(x, {})", y),
+                       [=] (f128 x) { return fm::pow(x, y); },
+                       [=] (f128 x) { return powq(x, y); },
+                       [=] (const qd_real& x) { return md::pow(x, qd_real{y}); }, 0.01, 100.0, 5.0);
+    }
+
+    // the fused kernel terms
+
+    const f128 max_exponent = truncq(logq(FLT128_MAX));
+    double worst{};
+    for (double d = -200.0; d <= 200.0; d += 0.0390625) {
+        const f128 delta = d + 0x1p-70Q;
+        f128 inv_cosh_term{};
+        f128 tanh_half_delta{};
+        f128 denomi{};
+        fm::occupation(delta, max_exponent, inv_cosh_term, tanh_half_delta, denomi);
+
+        const qd_real delta_qd = to_qd(delta);
+        worst = std::max({worst,
+                          ulps(inv_cosh_term, 0.5 / (1.0 + md::cosh(delta_qd))),
+                          ulps(tanh_half_delta, md::tanh(0.5 * delta_qd)),
+                          ulps(denomi, 1.0 / (1.0 + md::exp(delta_qd)))});
+    }
+    check(worst <= 3.0, std::format("occupation terms: max error {:.3f} ulp", worst));
+
+    f128 inv_cosh_term{};
+    f128 tanh_half_delta{};
+    f128 denomi{};
+    fm::occupation(-2.0Q * max_exponent, max_exponent, inv_cosh_term, tanh_half_delta, denomi);
+    check(inv_cosh_term == 0 && tanh_half_delta == -1 && denomi == 1, "occupation terms: large negative delta");
+    fm::occupation(2.0Q * max_exponent, max_exponent, inv_cosh_term, tanh_half_delta, denomi);
+    check(inv_cosh_term == 0 && tanh_half_delta == 1 && denomi == 0, "occupation terms: large positive delta");
+
+    check(fm::exp(20000.0Q) == expq(20000.0Q) && fm::exp(-20000.0Q) == 0 &&
+          fm::exp(0.0Q) == 1 && fm::expm1(0.0Q) == 0,
+          "exp limits");
+
+#else
+    util::println("no __float128 in this build");
+#endif
+
+    return checks_status();
+}
@@ -0,0 +1,234 @@
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <format>
+#include <string_view>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "derivative_kernels.H"
+#include "taylor_jet.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto relative_error(const real_t& a, const real_t& b) -> real_t
+{
+    if (b == 0.0_rt) {
+        return mp::abs(a);
+    }
+    return mp::abs(a - b) / mp::abs(b);
+}
+
+auto max_error(const EtaBetaDerivs<real_t>& a, const EtaBetaDerivs<real_t>& b) -> real_t
+{
+    return std::max({relative_error(a.deta, b.deta), relative_error(a.dbeta, b.dbeta),
+                     relative_error(a.deta2, b.deta2), relative_error(a.detadbeta, b.detadbeta),
+                     relative_error(a.dbeta2, b.dbeta2),
+                     relative_error(a.deta3, b.deta3), relative_error(a.deta2dbeta, b.deta2dbeta),
+                     relative_error(a.detadbeta2, b.detadbeta2), relative_error(a.dbeta3, b.dbeta3)});
+}
+
+// pointers to each derivative
+
+auto fields(EtaBetaDerivs<real_t>& d) -> std::array<real_t*, 9>
+{
+    return {&d.deta, &d.dbeta, &d.deta2, &d.detadbeta, &d.dbeta2,
+            &d.deta3, &d.deta2dbeta, &d.detadbeta2, &d.dbeta3};
+}
+
+auto fields(RhoTDerivs<real_t>& d) -> std::array<real_t*, 9>
+{
+    return {&d.drho, &d.dT, &d.drho2, &d.drhodT, &d.dT2,
+            &d.drho3, &d.drho2dT, &d.drhodT2, &d.dT3};
+}
+
+// the derivatives with each replaced by its magnitude.  The chain rule
+// is a sum of products of these with positive coefficients, so
+// evaluating it on the magnitudes gives the size of the terms that
+// cancel, which sets the roundoff error.
+
+template <typename D>
+auto magnitudes(D d) -> D
+{
+    for (auto* x : fields(d)) {
+        *x = mp::abs(*x);
+    }
+    return d;
+}
+
+auto scaled_error(const RhoTDerivs<real_t>& a, const RhoTDerivs<real_t>& b,
+                  const RhoTDerivs<real_t>& scale) -> real_t
+{
+    return std::max({mp::abs(a.drho - b.drho) / scale.drho, mp::abs(a.dT - b.dT) / scale.dT,
+                     mp::abs(a.drho2 - b.drho2) / scale.drho2, mp::abs(a.drhodT - b.drhodT) / scale.drhodT,
+                     mp::abs(a.dT2 - b.dT2) / scale.dT2,
+                     mp::abs(a.drho3 - b.drho3) / scale.drho3, mp::abs(a.drho2dT - b.drho2dT) / scale.drho2dT,
+                     mp::abs(a.drhodT2 - b.drhodT2) / scale.drhodT2, mp::abs(a.dT3 - b.dT3) / scale.dT3});
+}
+
+auto main() -> int
+{
+
+    // the generated kernels (tools/generate_derivative_kernels.py)
+    // against the hand-written ones in electron_positron.H.  They sum
+    // the terms in a different order, so they agree to roundoff
+    // compared to the size of the terms.
+
+    const real_t tol{1.e-12_rt};
+
+    const std::array<real_t, 4> etas{-20.0_rt, -1.0_rt, 5.0_rt, 100.0_rt};
+    const std::array<real_t, 3> betas{1.e-2_rt, 1.0_rt, 30.0_rt};
+
+    const real_t Ye{0.5_rt};
+
+    for (auto eta : etas) {
+        for (auto beta : betas) {
+
+            const real_t eta_tilde = -eta - 2.0_rt / beta;
+
+            FermiIntegral<real_t> f12(0.5_rt, eta, beta);
+            FermiIntegral<real_t> f32(1.5_rt, eta, beta);
+            FermiIntegral<real_t> f52(2.5_rt, eta, beta);
+            FermiIntegral<real_t> f12_pos(0.5_rt, eta_tilde, beta);
+            FermiIntegral<real_t> f32_pos(1.5_rt, eta_tilde, beta);
+            FermiIntegral<real_t> f52_pos(2.5_rt, eta_tilde, beta);
+
+            for (auto* f : {&f12, &f32, &f52, &f12_pos, &f32_pos, &f52_pos}) {
+                f->evaluate(3);
+            }
+
+            const real_t coeff = number_density_coeff<real_t>();
+
+            // the number density and pressure forms of q
+
+            const auto [dn_e, dn_pos] =
+                get_eta_beta_derivs<real_t, 3>(coeff, 1.0_rt, 3.0_rt, beta, f12, f32, f12_pos, f32_pos);
+            const auto [gn_e, gn_pos] =
+                derivative_kernels::eta_beta_derivs<real_t, 3>(coeff, 1.0_rt, 3.0_rt, beta, f12, f32, f12_pos, f32_pos);
+
+            const auto [dp_e, dp_pos] =
+                get_eta_beta_derivs<real_t, 3>(coeff, 0.5_rt, 5.0_rt, beta, f32, f52, f32_pos, f52_pos);
+            const auto [gp_e, gp_pos] =
+                derivative_kernels::eta_beta_derivs<real_t, 3>(coeff, 0.5_rt, 5.0_rt, beta, f32, f52, f32_pos, f52_pos);
+
+            const real_t err_eta_beta = std::max({max_error(gn_e, dn_e), max_error(gn_pos, dn_pos),
+                                                  max_error(gp_e, dp_e), max_error(gp_pos, dp_pos)});
+
+            check(err_eta_beta < tol,
+                  std::format("eta_beta_derivs, η = {:g}, β = {:g} (error {:.3g})",
+                              static_cast<double>(eta), static_cast<double>(beta),
+                              static_cast<double>(err_eta_beta)));
+
+            // the derivatives of η and the chain rule, from the same inputs
+
+            const auto deta = get_eta_thermo_derivs<real_t, 3>(Ye, dn_e, dn_pos);
+            const auto g_deta = derivative_kernels::eta_thermo_derivs<real_t, 3>(Ye, dn_e, dn_pos);
+
+            const auto dp_thermo = chain_rule<real_t, 3>(dp_e, deta);
+            const auto g_dp_thermo = derivative_kernels::chain_rule<real_t, 3>(dp_e, deta);
+
+            // each derivative of η is the chain rule of n⁻ - n⁺ (less
+            // its own term) divided by ∂(n⁻ - n⁺)/∂η
+
+            auto dn_scale = magnitudes(dn_e);
+            auto dn_pos_scale = magnitudes(dn_pos);
+            for (std::size_t n = 0; n < 9; ++n) {
+                *fields(dn_scale)[n] += *fields(dn_pos_scale)[n];
+            }
+
+            auto deta_scale = chain_rule<real_t, 3>(dn_scale, magnitudes(deta));
+            for (auto* x : fields(deta_scale)) {
+                *x /= dn_scale.deta;
+            }
+
+            const auto dp_scale = chain_rule<real_t, 3>(magnitudes(dp_e), magnitudes(deta));
+
+            const real_t err_thermo = std::max(scaled_error(g_deta, deta, deta_scale),
+                                               scaled_error(g_dp_thermo, dp_thermo, dp_scale));
+
+            check(err_thermo < tol,
+                  std::format("eta_thermo_derivs and chain_rule, η = {:g}, β = {:g} (error {:.3g})",
+                              static_cast<double>(eta), static_cast<double>(beta),
+                              static_cast<double>(err_thermo)));
+        }
+    }
+
+    // the entropy per volume, S = (E + P) / T - σ k η n, against the
+    // same expression evaluated on jets in (ρ, T) with arbitrary
+    // derivatives for E, P, n, and η
+
+    {
+        using Jet = TaylorJet<real_t, 3>;
+
+        const real_t rho{2.e5_rt};
+        const real_t temp{3.e8_rt};
+
+        auto quantity = [&] (real_t value, real_t scale, RhoTDerivs<real_t>& d) -> Jet
+        {
+            // derivatives of a few times value / ρⁱ Tʲ, with signs
+            // that vary
+            Jet q(value);
+            int n{1};
+            for (int i = 0; i <= 3; ++i) {
+                for (int j = 0; i + j <= 3; ++j) {
+                    if (i + j == 0) {
+                        continue;
+                    }
+                    const real_t sign = (n % 3 == 0) ? -1.0_rt : 1.0_rt;
+                    q[Jet::index(i, j)] = sign * scale * value * static_cast<real_t>(n) /
+                        (mp::pow(rho, static_cast<real_t>(i)) * mp::pow(temp, static_cast<real_t>(j)));
+                    ++n;
+                }
+            }
+            d.drho = q.derivative(1, 0);
+            d.dT = q.derivative(0, 1);
+            d.drho2 = q.derivative(2, 0);
+            d.drhodT = q.derivative(1, 1);
+            d.dT2 = q.derivative(0, 2);
+            d.drho3 = q.derivative(3, 0);
+            d.drho2dT = q.derivative(2, 1);
+            d.drhodT2 = q.derivative(1, 2);
+            d.dT3 = q.derivative(0, 3);
+            return q;
+        };
+
+        RhoTDerivs<real_t> dE;
+        RhoTDerivs<real_t> dP;
+        RhoTDerivs<real_t> dn;
+        RhoTDerivs<real_t> deta;
+
+        const Jet E = quantity(3.e24_rt, 0.7_rt, dE);
+        const Jet P = quantity(1.e24_rt, 0.4_rt, dP);
+        const Jet n = quantity(6.e28_rt, 1.1_rt, dn);
+        const Jet eta = quantity(2.5_rt, 0.3_rt, deta);
+
+        const Jet T_inv = reciprocal(Jet::variable(temp, 1));
+        const real_t k_B = C::values<real_t>().k;
+
+        for (auto sigma : {1.0_rt, -1.0_rt}) {
+
+            const Jet S = (E + P) * T_inv - (sigma * k_B) * (eta * n);
+
+            const auto dS = derivative_kernels::entropy_density_derivs<real_t, 3>(E.value(), dE, P.value(), dP,
+                                                                                  n.value(), dn, eta.value(), deta,
+                                                                                  sigma, 1.0_rt / temp);
+
+            const real_t err = std::max({relative_error(dS.drho, S.derivative(1, 0)),
+                                         relative_error(dS.dT, S.derivative(0, 1)),
+                                         relative_error(dS.drho2, S.derivative(2, 0)),
+                                         relative_error(dS.drhodT, S.derivative(1, 1)),
+                                         relative_error(dS.dT2, S.derivative(0, 2)),
+                                         relative_error(dS.drho3, S.derivative(3, 0)),
+                                         relative_error(dS.drho2dT, S.derivative(2, 1)),
+                                         relative_error(dS.drhodT2, S.derivative(1, 2)),
+                                         relative_error(dS.dT3, S.derivative(0, 3))});
+
+            check(err < tol, std::format("entropy_density_derivs, σ = {:g} (error {:.3g})",
+                                         static_cast<double>(sigma), static_cast<double>(err)));
+        }
+    }
+
+    return checks_status();
+}
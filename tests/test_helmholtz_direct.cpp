@@ -0,0 +1,76 @@
+#include <array>
+#include <string_view>
+
+#include "real_type.H"
+#include "helmholtz.H"
+#include "util.H"
+#include "mp_math.H"
+
+const std::array<real_t, 4> Ts{1.e4_rt, 1.e6_rt, 1.e8_rt, 5.e9_rt};
+const std::array<real_t, 5> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt, 5.e9_rt};
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // compare the direct Helmholtz evaluation to building F from the
+    // full EOS state.  All of the terms except the two mixed ones that
+    // come from the entropy derivatives should agree exactly.  Those
+    // two are computed from the Maxwell relations in the direct
+    // evaluation, so they differ at roundoff -- except in very
+    // degenerate matter, where the entropy chain rule in the full
+    // state suffers catastrophic cancellation and the direct
+    // evaluation is the more accurate one (see test_helmholtz.cpp).
+
+    const real_t Ye{0.5_rt};
+
+    ElectronPositronEOS<real_t> eos;
+
+    constexpr std::array<std::pair<real_t Helmholtz<real_t>::*, std::string_view>, 7> exact_terms{{
+        {&Helmholtz<real_t>::F, "F"},
+        {&Helmholtz<real_t>::dF_drho, "∂F/∂ρ"},
+        {&Helmholtz<real_t>::dF_dT, "∂F/∂T"},
+        {&Helmholtz<real_t>::d2F_drho2, "∂²F/∂ρ²"},
+        {&Helmholtz<real_t>::d2F_dT2, "∂²F/∂T²"},
+        {&Helmholtz<real_t>::d2F_drhodT, "∂²F/∂ρ∂T"},
+        {&Helmholtz<real_t>::d3F_drho2dT, "∂³F/∂ρ²∂T"}}};
+
+    int n_fail{};
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+
+            auto [helm, totals] = get_helmholtz_terms(rho, T, Ye);
+
+            auto es = eos.pe_state(rho, T, Ye);
+            auto helm_full = helmholtz_from_state(es);
+
+            for (const auto& [term, name] : exact_terms) {
+                if (helm.*term != helm_full.*term) {
+                    util::red_println("ρ = {:8.3g} T = {:8.3g}: {} differs", rho, T, name);
+                    ++n_fail;
+                }
+            }
+
+            // the table columns come from the same chain rules
+
+            if (totals.d3p_drho2dT != es.d3p_drho2dT || totals.d2eta_drhodT != es.d2eta_drhodT ||
+                totals.d2n_drhodT != es.d2n_drhodT) {
+                util::red_println("ρ = {:8.3g} T = {:8.3g}: table columns differ", rho, T);
+                ++n_fail;
+            }
+
+            real_t err3 = mp::abs(helm.d3F_drhodT2 - helm_full.d3F_drhodT2) / mp::abs(helm.d3F_drhodT2);
+            real_t err4 = mp::abs(helm.d4F_drho2dT2 - helm_full.d4F_drho2dT2) / mp::abs(helm.d4F_drho2dT2);
+
+            util::println("ρ = {:8.3g} T = {:8.3g}, relative difference: ∂³F/∂ρ∂T² = {:11.5g}, ∂⁴F/∂ρ²∂T² = {:11.5g}",
+                          rho, T, err3, err4);
+        }
+    }
+
+    if (n_fail == 0) {
+        util::green_println("direct Helmholtz terms agree with the full state");
+    }
+
+}
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <array>
+#include <format>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "util.H"
+#include "checks.H"
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+// the starting guesses, as a multiple of the true T, from above and
+// below the root
+
+const std::array<real_t, 2> guess_factors{3.0_rt, 0.3_rt};
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // compute a state from (ρ, T) and then recover T from (ρ, e),
+    // (ρ, p), and (ρ, s), starting from a guess that is off by a
+    // factor of 3 either way
+
+    const real_t Ye{0.5_rt};
+
+    // the inverted quantity should match to roundoff, and T as well,
+    // except where the quantity barely depends on T (degenerate
+    // states), where a relative error δ in the quantity gives an
+    // error δ / (∂ log q / ∂ log T) in T
+
+    const real_t tol{1.e-10_rt};
+
+    // without the cancellation-free entropy, s itself loses digits in
+    // degenerate states (ρ = 1e7, T = 1e5 has ~1e-7 error), which
+    // shows up in T(s)
+
+    const real_t tol_Ts = cancellation_free ? tol : 1.e-6_rt;
+
+    ElectronPositronEOS<real_t, 1> eos;
+
+    util::green_println("testing T(ρ, e), T(ρ, p), T(ρ, s)");
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+            for (auto factor : guess_factors) {
+
+                auto es = eos.pe_state(rho, T, Ye);
+
+                auto es_e = eos.try_pe_state_from_e(rho, es.e, Ye, factor * T);
+                auto es_p = eos.try_pe_state_from_p(rho, es.p, Ye, factor * T);
+                auto es_s = eos.try_pe_state_from_s(rho, es.s, Ye, factor * T);
+
+                if (!es_e || !es_p || !es_s) {
+                    check(false, std::format("ρ = {:g} T = {:g}, guess {:g} T: solve failed",
+                                             static_cast<double>(rho), static_cast<double>(T),
+                                             static_cast<double>(factor)));
+                    continue;
+                }
+
+                // the error in the inverted quantity itself
+                const real_t err_e = util::rel_error(es_e->e, es.e);
+                const real_t err_p = util::rel_error(es_p->p, es.p);
+                const real_t err_s = util::rel_error(es_s->s, es.s);
+
+                // and in the recovered T, scaled by how strongly the
+                // quantity depends on T
+                const real_t err_Te = util::rel_error(es_e->temp, T) * T * es.de_dT / es.e;
+                const real_t err_Tp = util::rel_error(es_p->temp, T) * T * es.dp_dT / es.p;
+                const real_t err_Ts = util::rel_error(es_s->temp, T) * T * es.ds_dT / es.s;
+
+                const real_t err = std::max({err_e, err_p, err_s, err_Te, err_Tp});
+
+                check(err < tol && err_Ts < tol_Ts,
+                      std::format("ρ = {:8.3g} T = {:8.3g}, guess {:3.1f} T:  T(e) = {:15.8g}  T(p) = {:15.8g}  T(s) = {:15.8g}  "
+                                  "errors (e, p, s) = {:11.5g} {:11.5g} {:11.5g}  T errors = {:11.5g} {:11.5g} {:11.5g}",
+                                  static_cast<double>(rho), static_cast<double>(T), static_cast<double>(factor),
+                                  static_cast<double>(es_e->temp), static_cast<double>(es_p->temp),
+                                  static_cast<double>(es_s->temp),
+                                  static_cast<double>(err_e), static_cast<double>(err_p), static_cast<double>(err_s),
+                                  static_cast<double>(err_Te), static_cast<double>(err_Tp),
+                                  static_cast<double>(err_Ts)));
+            }
+        }
+    }
+
+    return checks_status();
+}
@@ -0,0 +1,79 @@
+#include <format>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <string>
+#include <string_view>
+
+#include "real_type.H"
+#include "fermi_integrals.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto main() -> int
+{
+
+#if defined(USE_MIXED_PRECISION_QUAD) && defined(EOS_HAVE_FLOAT128) && defined(EOS_HAVE_MULTI_DOUBLE)
+
+    // the Fermi integrals in __float128, with the small terms of the
+    // quadratures in double and long double, should be as accurate
+    // as if every term was evaluated in __float128.  We compare to
+    // quad-double with the same quadrature, for the terms whose
+    // integrand does not change sign (the others can cancel, so
+    // their relative error is not bounded by the rounding of the
+    // terms).
+
+    using multi_double::qd_real;
+
+    constexpr std::array<double, 2> ks{0.5, 2.5};
+    constexpr std::array<double, 4> etas{-50.0, 0.0, 50.0, 500.0};
+    constexpr std::array<double, 2> betas{1.e-3, 30.0};
+
+    // about 10 ulp of a __float128
+
+    constexpr double tol{2.e-33};
+
+    double max_error{};
+
+    for (auto k : ks) {
+        for (auto eta : etas) {
+            for (auto beta : betas) {
+
+                FermiIntegral<__float128> f(k, eta, beta);
+                f.evaluate(3);
+
+                FermiIntegral<qd_real> f_qd(k, eta, beta);
+                f_qd.evaluate(3);
+
+                double error{};
+                for (auto [eta_der, beta_der] : FermiIntegral<__float128>::derivs) {
+                    if (eta_der >= 2) {
+                        continue;
+                    }
+                    const qd_real exact = f_qd.term(eta_der, beta_der);
+                    const double diff = static_cast<double>(
+                        qd_real(static_cast<long double>(f.term(eta_der, beta_der))) - exact +
+                        qd_real(static_cast<double>(f.term(eta_der, beta_der) -
+                                                    static_cast<long double>(f.term(eta_der, beta_der)))));
+                    error = std::max(error, std::abs(diff / static_cast<double>(exact)));
+                }
+
+                util::println("k = {:4.1f}, η = {:6.1f}, β = {:6.3g}: largest relative error = {:12.5g}",
+                              k, eta, beta, error);
+                max_error = std::max(max_error, error);
+            }
+        }
+    }
+
+    check(max_error < tol, "mixed precision quadrature");
+
+#else
+
+    util::println("needs MIXED_PRECISION_QUAD=TRUE and MULTI_PRECISION=TRUE, skipping");
+
+#endif
+
+    return checks_status();
+}
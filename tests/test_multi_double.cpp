@@ -0,0 +1,77 @@
+#include <array>
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "multi_double.H"
+#include "util.H"
+#include "checks.H"
+
+template <typename R>
+auto rel_diff(const R& a, const R& b) -> double
+{
+    return std::abs(static_cast<double>((a - b) / b));
+}
+
+// compare the double-double or quad-double functions to values
+// computed with 90 digits (using Python's decimal module)
+
+template <typename R>
+void check_type(std::string_view name, double tol)
+{
+    using namespace multi_double;
+
+    const std::array<std::pair<const char*, std::pair<R, const char*>>, 16> cases{{
+        {"sqrt(2)", {sqrt(R{2.0}), "1.4142135623730950488016887242096980785696718753769480731766797379907325e+0"}},
+        {"exp(1)", {exp(R{1.0}), "2.7182818284590452353602874713526624977572470936999595749669676277240766e+0"}},
+        {"exp(-50.5)", {exp(R{-50.5}), "1.1698459177061964685851625184541888630533196921741161467396755994023567e-22"}},
+        {"exp(300.25)", {exp(R{300.25}), "2.4941248615349212861016143149068194319534538911968655233944294799923214e+130"}},
+        {"log(10)", {log(R{10.0}), "2.3025850929940456840179914546843642076011014886287729760333279009675726e+0"}},
+        {"log(0.375)", {log(R{0.375}), "-9.8082925301172623685645112745200399957900984525801631062734569484268657e-1"}},
+        {"log1p(2^-7)", {log1p(R{0.0078125}), "7.7821404420549489474629000611367636781258021825180880816195321065981133e-3"}},
+        {"log1p(-0.25)", {log1p(R{-0.25}), "-2.8768207245178092743921900599382743150350971089776105650666568534929295e-1"}},
+        {"log1p(2^-70)", {log1p(R{0x1p-70}), "8.4703294725430033906796376827277480888123532936128969101276553224335909e-22"}},
+        {"cosh(3.25)", {cosh(R{3.25}), "1.2914557062512392049483503752322409009957706455444996889871596794065983e+1"}},
+        {"tanh(2^-5)", {tanh(R{0.03125}), "3.1239831446031256768178679109136950564963574974225775008241207265312415e-2"}},
+        {"tanh(2.5)", {tanh(R{2.5}), "9.8661429815143028888127603923734963921251198218540693946157551388023183e-1"}},
+        {"pow(7.25, 2.5)", {pow(R{7.25}, R{2.5}), "1.4152886258750368407130773510579428615138112674822710664028771473387498e+2"}},
+        {"pow(7.25, 6)", {pow(R{7.25}, R{6.0}), "1.4522053735351562500000000000000000000000000000000000000000000000000000e+5"}},
+        {"pow(3.125, 1.375)", {pow(R{3.125}, R{1.375}), "4.7909184649789368564162791229924996453997063443948504777620702340016434e+0"}},
+        {"1/3", {R{1.0} / R{3.0}, "3.3333333333333333333333333333333333333333333333333333333333333333333333e-1"}}
+    }};
+
+    for (const auto& [what, c] : cases) {
+        const double err = rel_diff(c.first, from_string<R>(c.second));
+        check(err < tol, std::string(name) + ": " + what);
+    }
+
+    // identities
+
+    const R third = R{1.0} / R{3.0};
+    const R x = from_string<R>("1.2345678901234567890123456789012345678901234567890123456789");
+
+    check(rel_diff(third * 3.0, R{1.0}) < tol &&
+          rel_diff(exp(log(x)), x) < tol &&
+          rel_diff(sqrt(x) * sqrt(x), x) < tol,
+          std::string(name) + ": inverses");
+
+    const R s = sin(x);
+    const R c = cos(x);
+    check(std::abs(static_cast<double>(s * s + c * c - 1.0)) < tol &&
+          rel_diff(sin(R::pi() / 6.0), R{0.5}) < tol,
+          std::string(name) + ": sin and cos");
+
+    check(floor(R{-2.5}) == R{-3.0} && trunc(R{-2.5}) == R{-2.0} &&
+          static_cast<int>(R{-2.5}) == -2 &&
+          trunc(R{1.0} - std::numeric_limits<R>::epsilon()) == R{0.0},
+          std::string(name) + ": rounding");
+}
+
+auto main() -> int
+{
+    check_type<multi_double::dd_real>("double-double", 1.e-30);
+    check_type<multi_double::qd_real>("quad-double", 1.e-60);
+
+    return checks_status();
+}
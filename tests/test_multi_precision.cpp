@@ -0,0 +1,80 @@
+#include <format>
+#include <limits>
+#include <string>
+#include <tuple>
+#include <type_traits>
+
+#include "real_type.H"
+#include "precision.H"
+#include "fermi_integrals.H"
+#include "fundamental_constants.H"
+#include "electron_positron.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+// the relative difference, computed in double
+
+template <typename T>
+auto rel_diff(const T& a, const T& b) -> double
+{
+    return static_cast<double>(mp::abs((a - b) / b));
+}
+
+// evaluate a Fermi integral and an EOS state in the number type T and
+// compare to the same thing computed in real_t
+
+template <typename T>
+void check_type()
+{
+    const auto name = std::string(precision::name<T>());
+
+    // constants
+
+    check(rel_diff(static_cast<real_t>(C::values<T>().rest_mass), C::rest_mass) < 1.e-15 &&
+          rel_diff(static_cast<real_t>(constants::values<T>().pi), constants::pi) < 1.e-15,
+          name + ": constants");
+
+    // Fermi integral (compared to the Gong et al. code)
+
+    FermiIntegral<T> f(static_cast<T>(0.5L), static_cast<T>(1.0L), static_cast<T>(10.0L));
+    f.evaluate(2);
+
+    check(rel_diff(f.F, static_cast<T>(4.3093121530612724L)) < 1.e-15 &&
+          rel_diff(f.dF_deta, static_cast<T>(3.0909917562756424L)) < 1.e-15,
+          name + ": Fermi integral");
+
+    // an EOS state
+
+    ElectronPositronEOS<real_t, 1> eos_rt;
+    ElectronPositronEOS<T, 1> eos;
+
+    auto es_rt = eos_rt.try_pe_state(1.e4_rt, 1.e7_rt, 0.5_rt);
+    auto es = eos.try_pe_state(static_cast<T>(1.e4L), static_cast<T>(1.e7L), static_cast<T>(0.5L));
+
+    check(es && es_rt &&
+          rel_diff(static_cast<real_t>(es->p), es_rt->p) < 1.e-13 &&
+          rel_diff(static_cast<real_t>(es->dp_dT), es_rt->dp_dT) < 1.e-10,
+          name + ": EOS state");
+}
+
+auto main() -> int
+{
+
+    // every number type built into this executable (only real_t,
+    // unless built with MULTI_PRECISION=TRUE)
+
+    []<typename... Ts>(std::type_identity<std::tuple<Ts...>>) {
+        (check_type<Ts>(), ...);
+    }(std::type_identity<precision::types>{});
+
+    // selecting a type by name
+
+    auto digits = precision::dispatch("double", [] <typename T> () { return std::numeric_limits<T>::digits; });
+    check(!precision::dispatch("not-a-type", [] <typename T> () { return 0; }) &&
+          (std::is_same_v<real_t, double> ? digits == 53 : !digits.has_value()),
+          "dispatch by name");
+
+    return checks_status();
+}
@@ -0,0 +1,23 @@
+
+#include <utility>
+
+#include "multisection.H"
+#include "real_type.H"
+#include "util.H"
+#include "mp_math.H"
+
+auto main() -> int
+{
+
+    const real_t a = -4.0_rt;
+    const real_t b = 4.0_rt / 3.0_rt;
+
+    auto r = multisection<real_t>([=] (real_t x) -> real_t
+                                  {return (x + 3.0_rt) * mp::pow(x - 1.0_rt, 2);},
+                                  [=] (real_t x) -> std::pair<real_t, real_t>
+                                  {return {(x + 3.0_rt) * mp::pow(x - 1.0_rt, 2),
+                                           mp::pow(x - 1.0_rt, 2) + 2.0_rt * (x + 3.0_rt) * (x - 1.0_rt)};},
+                                  a, b);
+
+    util::println("root = {}", r.value());
+}
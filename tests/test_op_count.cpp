@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <format>
+#include <string_view>
+#include <utility>
+
+#include "real_type.H"
+#include "counting_real.H"
+#include "electron_positron.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+using R = counting::real;
+using counting::Op;
+using counting::Phase;
+
+auto main() -> int
+{
+
+#if defined(USE_BOOST256) || defined(USE_FLOAT128) || defined(USE_LONG_DOUBLE) || defined(USE_DD) || defined(USE_QD)
+
+    // the constants and literals are real_t, which counting::real only
+    // converts from if it is a double
+
+    util::println("counting::real needs real_t = double (or PRECISION=COUNTING), skipping");
+
+#else
+
+    // each operation is counted once, in the current phase
+
+    {
+        counting::reset();
+
+        const R a{1.5};
+        const R b{2.0};
+        const R c = a * b + a / b - 1.0;
+        const R d = mp::exp(c) + mp::sqrt(b);
+
+        const auto& n = counting::counts;
+
+        check(n(Phase::other, Op::add) == 3 && n(Phase::other, Op::mul) == 1 &&
+              n(Phase::other, Op::div) == 1 && n(Phase::other, Op::exp) == 1 &&
+              n(Phase::other, Op::sqrt) == 1,
+              "arithmetic and mp:: calls are counted");
+
+        const double c_d = 1.5 * 2.0 + 1.5 / 2.0 - 1.0;
+
+        check(static_cast<double>(c) == c_d && static_cast<double>(d) == std::exp(c_d) + std::sqrt(2.0),
+              "the values are the same as for double");
+    }
+
+    // scopes nest, and an operation is charged to the innermost one
+
+    {
+        counting::reset();
+
+        R x{3.0};
+        {
+            const counting::Scope<R> outer(Phase::brent);
+            x *= x;
+            {
+                const counting::Scope<R> inner(Phase::fermi_0);
+                x += x;
+                x += x;
+            }
+            x /= 2.0;
+        }
+        x -= 1.0;
+
+        // a scope for any other type does nothing
+
+        {
+            const counting::Scope<double> ignored(Phase::entropy);
+            x += 1.0;
+        }
+
+        const auto& n = counting::counts;
+
+        check(n(Phase::brent, Op::mul) == 1 && n(Phase::brent, Op::div) == 1 &&
+              n(Phase::brent, Op::add) == 0 && n(Phase::fermi_0, Op::add) == 2 &&
+              n(Phase::other, Op::add) == 2 && n.entries[static_cast<std::size_t>(Phase::brent)] == 1 &&
+              n.entries[static_cast<std::size_t>(Phase::entropy)] == 0,
+              "nested phases");
+    }
+
+    // the EOS in counting::real gives exactly the double result, and
+    // counts each of the phases it goes through, the same way each
+    // time (after the first call, which also builds the constants)
+
+    const std::array<std::pair<double, double>, 4> states{{
+        {1.e-2, 1.e9}, {1.e4, 1.e7}, {1.e7, 1.e8}, {5.e9, 5.e9}}};
+
+    for (auto [rho, T] : states) {
+
+        ElectronPositronEOS<R> eos_c;
+
+        [[maybe_unused]] const auto warm_up = eos_c.pe_state(rho, T, 0.5);
+
+        counting::reset();
+        [[maybe_unused]] const auto state_c = eos_c.pe_state(rho, T, 0.5);
+        const counting::Counts first = counting::counts;
+
+        counting::reset();
+        [[maybe_unused]] const auto again = eos_c.pe_state(rho, T, 0.5);
+
+#if !defined(USE_COUNTING)
+
+        // (with PRECISION=COUNTING, real_t can't be converted to double)
+
+        ElectronPositronEOS<double> eos_d;
+        const auto state_d = eos_d.pe_state(rho, T, 0.5);
+
+        // the compiler may fold a libm call on a constant for one type
+        // and not the other, so these agree to roundoff
+
+        auto error = [] (const R& a, const double b) -> double
+        {
+            return std::abs(static_cast<double>(a) - b) / std::abs(b);
+        };
+
+        const double err = std::max({error(state_c.eta, state_d.eta), error(state_c.p, state_d.p),
+                                     error(state_c.s, state_d.s), error(state_c.dp_dT, state_d.dp_dT),
+                                     error(state_c.d2s_dT2, state_d.d2s_dT2),
+                                     error(state_c.d3e_drhodT2, state_d.d3e_drhodT2)});
+
+        check(err < 1.e-10, std::format("counting::real agrees with double, ρ = {:g}, T = {:g} (error {:.3g})",
+                                        rho, T, err));
+#endif
+
+        bool entered{true};
+        for (auto phase : {Phase::eta_bounds, Phase::brent, Phase::fermi_0, Phase::fermi_3,
+                           Phase::eta_beta_derivs, Phase::eta_thermo_derivs, Phase::chain_rule,
+                           Phase::entropy}) {
+            entered = entered && first.entries[static_cast<std::size_t>(phase)] > 0;
+        }
+
+        check(entered && first.ops == counting::counts.ops && first.entries == counting::counts.entries,
+              std::format("phases counted, ρ = {:g}, T = {:g} ({} multiplies)",
+                          rho, T, first.total(Op::mul)));
+    }
+
+#endif
+
+    return checks_status();
+}
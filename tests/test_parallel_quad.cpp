@@ -0,0 +1,54 @@
+#include <array>
+
+#include "real_type.H"
+#include "fermi_integrals.H"
+#include "util.H"
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // evaluate a set of Fermi integrals together (in parallel, if
+    // built with USE_PARALLEL_QUAD) and check that they agree exactly
+    // with evaluating each one by itself.  We also evaluate in two
+    // steps (mode 1 then mode 3) to check that the already-computed
+    // terms are kept.
+
+#ifdef USE_PARALLEL_QUAD
+    util::println("parallel quadrature enabled");
+#endif
+
+    const std::array<real_t, 5> etas{-50.0_rt, -2.0_rt, 0.5_rt, 10.0_rt, 1.e4_rt};
+    const std::array<real_t, 3> betas{1.e-4_rt, 0.5_rt, 20.0_rt};
+    const std::array<real_t, 3> ks{0.5_rt, 1.5_rt, 2.5_rt};
+
+    for (auto eta : etas) {
+        for (auto beta : betas) {
+
+            std::array<FermiIntegral<real_t>, 3> fs{{{ks[0], eta, beta},
+                                                     {ks[1], eta, beta},
+                                                     {ks[2], eta, beta}}};
+            auto fs_serial = fs;
+
+            std::array<FermiIntegral<real_t>*, 3> ptrs{&fs[0], &fs[1], &fs[2]};
+            evaluate_fermi_integrals<real_t>(ptrs, 1);
+            evaluate_fermi_integrals<real_t>(ptrs, 3);
+
+            bool same{true};
+            for (std::size_t n = 0; n < fs.size(); ++n) {
+                fs_serial[n].evaluate(3);
+                for (auto [eta_der, beta_der] : FermiIntegral<real_t>::derivs) {
+                    same = same && fs[n].term(eta_der, beta_der) == fs_serial[n].term(eta_der, beta_der);
+                }
+            }
+
+            if (same) {
+                util::green_println("η = {:8.3g} β = {:8.3g}: integrals agree", eta, beta);
+            } else {
+                util::red_println("η = {:8.3g} β = {:8.3g}: integrals differ", eta, beta);
+            }
+        }
+    }
+
+}
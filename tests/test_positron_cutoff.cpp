@@ -0,0 +1,48 @@
+#include <array>
+#include <limits>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "fundamental_constants.H"
+#include "util.H"
+
+const std::array<real_t, 8> Ts{1.e4_rt, 1.e6_rt, 1.e7_rt, 3.e7_rt, 1.e8_rt, 3.e8_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 5> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt, 5.e9_rt};
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // check that whenever positrons_negligible() says we can skip the
+    // positrons, the positron number density is actually below
+    // roundoff compared to the electrons
+
+    const real_t Ye{0.5_rt};
+    constexpr int deriv_level{3};
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+
+            const real_t beta = C::dbeta_dT * T;
+            const real_t eta = get_eta(rho * Ye, T).value();
+
+            FermiIntegral<real_t> f12(0.5_rt, eta, beta);
+            f12.evaluate(0);
+
+            const bool skip = positrons_negligible(eta, beta, f12.F, deriv_level);
+
+            const real_t n_e = n_e_constraint(eta, beta);
+            const real_t n_pos = n_p_constraint(eta, beta);
+            const real_t ratio = n_pos / n_e;
+
+            if (skip && ratio > std::numeric_limits<real_t>::epsilon()) {
+                util::red_println("ρ = {:8.3g} T = {:8.3g}: positrons skipped, but n⁺/n⁻ = {:11.5g}",
+                                  rho, T, ratio);
+            } else {
+                util::println("ρ = {:8.3g} T = {:8.3g}: skip positrons = {:5}, n⁺/n⁻ = {:11.5g}",
+                              rho, T, skip, ratio);
+            }
+        }
+    }
+}
@@ -0,0 +1,68 @@
+#include <array>
+#include <sstream>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "util.H"
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // the trimmed states should only hold the fields they store
+
+    util::println("sizeof(EOSState<real_t, 3>)  = {}", sizeof(EOSState<real_t, 3>));
+    util::println("sizeof(EOSState<real_t, 2>)  = {}", sizeof(EOSState<real_t, 2>));
+    util::println("sizeof(EOSState<real_t, 1>)  = {}", sizeof(EOSState<real_t, 1>));
+    util::println("sizeof(EOSTotals<real_t, 3>) = {}", sizeof(EOSTotals<real_t, 3>));
+    util::println("sizeof(EOSTotals<real_t, 1>) = {}", sizeof(EOSTotals<real_t, 1>));
+
+    static_assert(sizeof(EOSState<real_t, 3>) == 134 * sizeof(real_t));
+    static_assert(sizeof(EOSState<real_t, 1>) == 43 * sizeof(real_t));
+    static_assert(sizeof(EOSTotals<real_t, 3>) == 54 * sizeof(real_t));
+    static_assert(sizeof(EOSTotals<real_t, 1>) == 19 * sizeof(real_t));
+
+    // a deriv_level = 1 state and the totals extracted from a full
+    // state should agree exactly with the full state
+
+    const real_t Ye{0.5_rt};
+
+    ElectronPositronEOS<real_t, 1> eos1;
+    ElectronPositronEOS<real_t, 3> eos3;
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+
+            auto es1 = eos1.pe_state(rho, T, Ye);
+            auto es3 = eos3.pe_state(rho, T, Ye);
+
+            EOSTotals<real_t> totals(es3);
+
+            // widening fills in only what the trimmed state has
+            EOSState<real_t> es1_wide(es1);
+
+            const bool same =
+                es1.p == es3.p && es1.dpe_dT == es3.dpe_dT && es1.ds_drho == es3.ds_drho &&
+                totals.e == es3.e && totals.d2p_drhodT == es3.d2p_drhodT &&
+                totals.d3eta_dT3 == es3.d3eta_dT3 &&
+                es1_wide.s_pos == es3.s_pos && es1_wide.d2p_dT2 == 0.0_rt;
+
+            if (same) {
+                util::green_println("ρ = {:8.3g} T = {:8.3g}: trimmed states agree", rho, T);
+            } else {
+                util::red_println("ρ = {:8.3g} T = {:8.3g}: trimmed states differ", rho, T);
+            }
+        }
+    }
+
+    // the output of a trimmed state should only include what it stores
+
+    std::ostringstream os;
+    os << EOSTotals<real_t, 1>(eos1.pe_state(1.e5_rt, 1.e7_rt, Ye));
+    util::println("{}", os.str());
+
+}
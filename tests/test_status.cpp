@@ -0,0 +1,66 @@
+#include <limits>
+
+#include "brent.H"
+#include "degeneracy_parameter_bounds.H"
+#include "electron_positron.H"
+#include "eos_status.H"
+#include "real_type.H"
+#include "util.H"
+
+using namespace literals;
+
+// check that failures are reported back as a status instead of
+// aborting
+
+template <typename R>
+void check(const char* name, const R& result, EOSStatus expected)
+{
+    EOSStatus status = result ? EOSStatus::success : result.error();
+    if (status == expected) {
+        util::green_println("{:32}: {}", name, status_message(status));
+    } else {
+        util::red_println("{:32}: {} (expected {})", name, status_message(status),
+                          status_message(expected));
+    }
+}
+
+auto main() -> int
+{
+
+    auto r = brent<real_t>([] (real_t x) -> real_t {return x * x + 1.0_rt;},
+                           -1.0_rt, 1.0_rt);
+    check("brent without a root", r, EOSStatus::root_not_bracketed);
+
+    auto r_nan = brent<real_t>([] (real_t) -> real_t {return std::numeric_limits<real_t>::quiet_NaN();},
+                               -1.0_rt, 1.0_rt);
+    check("brent with NaN", r_nan, EOSStatus::root_not_bracketed);
+
+    check("eta bounds above the table", bounds::get_eta_bounds(1.0_rt, 1.e13_rt),
+          EOSStatus::out_of_table);
+
+    // off the table, we fall back to wide bounds, which still work here
+
+    check("eta above the table", get_eta(1.0_rt, 1.e13_rt), EOSStatus::success);
+
+    check("eta with NaN density", get_eta(std::numeric_limits<real_t>::quiet_NaN(), 1.e7_rt),
+          EOSStatus::eta_solve_failed);
+
+    ElectronPositronEOS<real_t, 1> eos;
+
+    check("pe_state", eos.try_pe_state(1.e4_rt, 1.e7_rt, 0.5_rt), EOSStatus::success);
+
+    check("pe_state with NaN temperature",
+          eos.try_pe_state(1.e4_rt, std::numeric_limits<real_t>::quiet_NaN(), 0.5_rt),
+          EOSStatus::eta_solve_failed);
+
+    check("pe_state_from_e with negative e",
+          eos.try_pe_state_from_e(1.e4_rt, -1.0_rt, 0.5_rt, 1.e7_rt),
+          EOSStatus::temp_solve_failed);
+
+    try {
+        auto es = eos.pe_state(1.e4_rt, -1.0_rt, 0.5_rt);
+        util::red_println("{:32}: no exception, T = {}", "pe_state with negative T", es.temp);
+    } catch (const EOSError& e) {
+        util::green_println("{:32}: {}", "pe_state with negative T", e.what());
+    }
+}
@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <array>
+#include <format>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "real_type.H"
+#include "taylor_jet.H"
+#include "fermi_integrals.H"
+#include "helmholtz.H"
+#include "difference_utils.H"
+#include "util.H"
+#include "checks.H"
+
+using namespace literals;
+
+auto relative_error(const real_t& a, const real_t& b) -> real_t
+{
+    return mp::abs(a - b) / mp::abs(b);
+}
+
+auto main() -> int
+{
+
+    const real_t eps = std::numeric_limits<real_t>::epsilon();
+
+    // the jet arithmetic on functions with known derivatives:
+    //
+    //   u^{1/2} e^{2v}: ∂ⁱ∂ʲ = (1/2)(-1/2)...(3/2 - i) u^{1/2 - i} 2^j e^{2v}
+    //   1 / (u v):      ∂ⁱ∂ʲ = (-1)^{i+j} i! j! u^{-1-i} v^{-1-j}
+
+    {
+        constexpr int N{5};
+        using Jet = TaylorJet<real_t, N>;
+
+        const real_t u0{1.7_rt};
+        const real_t v0{0.3_rt};
+        const Jet u = Jet::variable(u0, 0);
+        const Jet v = Jet::variable(v0, 1);
+
+        const Jet g = sqrt(u) * exp(2.0_rt * v);
+        const Jet h = 1.0_rt / (u * v);
+
+        real_t err{};
+        for (int i = 0; i <= N; ++i) {
+            for (int j = 0; i + j <= N; ++j) {
+                real_t dg = mp::sqrt(u0) * mp::exp(2.0_rt * v0) * mp::pow(2.0_rt, static_cast<real_t>(j));
+                real_t dh = 1.0_rt / (u0 * v0);
+                for (int m = 0; m < i; ++m) {
+                    dg *= (0.5_rt - static_cast<real_t>(m)) / u0;
+                    dh *= -static_cast<real_t>(m + 1) / u0;
+                }
+                for (int m = 0; m < j; ++m) {
+                    dh *= -static_cast<real_t>(m + 1) / v0;
+                }
+                err = std::max({err, relative_error(g.derivative(i, j), dg),
+                                relative_error(h.derivative(i, j), dh)});
+            }
+        }
+
+        check(err < 100.0_rt * eps, std::format("jet arithmetic through order {} (error {:.3g})",
+                                                N, static_cast<double>(err)));
+    }
+
+    // the Fermi and entropy integrals from a single jet against the
+    // quadrature of each derivative's own kernel.  The two use
+    // different break points, so they agree to the quadrature error.
+
+    const std::array<real_t, 4> etas{-5.0_rt, 0.0_rt, 3.0_rt, 10.0_rt};
+    const std::array<real_t, 3> betas{1.e-3_rt, 0.5_rt, 10.0_rt};
+
+    for (auto occupation : {Occupation::fermi, Occupation::entropy}) {
+        for (auto eta : etas) {
+            for (auto beta : betas) {
+
+                FermiIntegral<real_t> f(1.5_rt, eta, beta, occupation);
+                f.evaluate(3);
+
+                const auto jet = f.jet<3>();
+
+                real_t err{};
+                for (auto [eta_der, beta_der] : FermiIntegral<real_t>::derivs) {
+                    err = std::max(err, relative_error(jet.derivative(eta_der, beta_der),
+                                                       f.term(eta_der, beta_der)));
+                }
+
+                check(err < 1.e-10_rt,
+                      std::format("{} jet, η = {:g}, β = {:g} (error {:.3g})",
+                                  occupation == Occupation::fermi ? "Fermi" : "entropy",
+                                  static_cast<double>(eta), static_cast<double>(beta),
+                                  static_cast<double>(err)));
+            }
+        }
+    }
+
+    // a lower-order jet is exactly the leading part of a higher one
+
+    {
+        FermiIntegral<real_t> f(0.5_rt, 2.0_rt, 0.1_rt);
+        const auto j1 = f.jet<1>();
+        const auto j4 = f.jet<4>();
+
+        bool same{true};
+        for (std::size_t n = 0; n < j1.size; ++n) {
+            same = same && j1[n] == j4[n];
+        }
+        check(same, "jet<1> is the leading part of jet<4>");
+    }
+
+    // the fourth derivatives, which the per-derivative kernels do not
+    // have, against differences of the third derivatives
+
+    for (auto eta : {-2.0_rt, 1.0_rt, 8.0_rt}) {
+        for (auto beta : {0.01_rt, 2.0_rt}) {
+
+            const real_t k{2.5_rt};
+            const auto jet = FermiIntegral<real_t>(k, eta, beta).jet<4>();
+
+            real_t err{};
+            for (int i = 0; i <= 3; ++i) {
+                const int j = 3 - i;
+
+                auto [d_deta, d_deta_err] = fd::adaptive_diff<real_t>([&] (real_t eta_) -> real_t
+                    {
+                        return FermiIntegral<real_t>(k, eta_, beta).jet<3>().derivative(i, j);
+                    }, eta, 0.05_rt);
+
+                auto [d_dbeta, d_dbeta_err] = fd::adaptive_diff<real_t>([&] (real_t beta_) -> real_t
+                    {
+                        return FermiIntegral<real_t>(k, eta, beta_).jet<3>().derivative(i, j);
+                    }, beta, 0.05_rt * beta);
+
+                err = std::max({err, relative_error(jet.derivative(i + 1, j), d_deta),
+                                relative_error(jet.derivative(i, j + 1), d_dbeta)});
+            }
+
+            check(err < 1.e-6_rt, std::format("fourth derivatives, η = {:g}, β = {:g} (error {:.3g})",
+                                              static_cast<double>(eta), static_cast<double>(beta),
+                                              static_cast<double>(err)));
+        }
+    }
+
+    // the Helmholtz free energy from a fourth-order jet against the
+    // terms built from the EOS state
+
+    const real_t Ye{0.5_rt};
+
+    const std::array<std::pair<real_t, real_t>, 5> states{{
+        {1.e2_rt, 1.e6_rt}, {1.e5_rt, 1.e8_rt}, {1.e7_rt, 1.e8_rt},
+        {1.e5_rt, 5.e9_rt}, {5.e9_rt, 5.e9_rt}}};
+
+    for (auto [rho, T] : states) {
+
+        auto [helm, totals] = get_helmholtz_terms(rho, T, Ye);
+        auto jet_helm = helmholtz_from_jet(get_helmholtz_jet<4>(rho, T, Ye), rho, T, Ye);
+
+        const real_t err = std::max({relative_error(jet_helm.F, helm.F),
+                                     relative_error(jet_helm.dF_drho, helm.dF_drho),
+                                     relative_error(jet_helm.dF_dT, helm.dF_dT),
+                                     relative_error(jet_helm.d2F_drho2, helm.d2F_drho2),
+                                     relative_error(jet_helm.d2F_dT2, helm.d2F_dT2),
+                                     relative_error(jet_helm.d2F_drhodT, helm.d2F_drhodT),
+                                     relative_error(jet_helm.d3F_drhodT2, helm.d3F_drhodT2),
+                                     relative_error(jet_helm.d3F_drho2dT, helm.d3F_drho2dT),
+                                     relative_error(jet_helm.d4F_drho2dT2, helm.d4F_drho2dT2)});
+
+        check(err < 1.e-8_rt, std::format("Helmholtz jet, ρ = {:g}, T = {:g} (error {:.3g})",
+                                          static_cast<double>(rho), static_cast<double>(T),
+                                          static_cast<double>(err)));
+
+        // and the fourth derivatives that helmholtz_from_state cannot
+        // give, against differences of the third
+
+        const auto jet = get_helmholtz_jet<4>(rho, T, Ye);
+
+        auto [d4_drho4, d4_drho4_err] = fd::adaptive_diff<real_t>([&] (real_t rho_) -> real_t
+            {
+                return get_helmholtz_jet<3>(rho_, T, Ye).derivative(3, 0);
+            }, rho, 0.01_rt * rho);
+
+        auto [d4_dT4, d4_dT4_err] = fd::adaptive_diff<real_t>([&] (real_t T_) -> real_t
+            {
+                return get_helmholtz_jet<3>(rho, T_, Ye).derivative(0, 3);
+            }, T, 0.01_rt * T);
+
+        const real_t err4 = std::max(relative_error(jet.derivative(4, 0), d4_drho4),
+                                     relative_error(jet.derivative(0, 4), d4_dT4));
+
+        check(err4 < 1.e-5_rt, std::format("∂⁴F/∂ρ⁴ and ∂⁴F/∂T⁴, ρ = {:g}, T = {:g} (error {:.3g})",
+                                           static_cast<double>(rho), static_cast<double>(T),
+                                           static_cast<double>(err4)));
+    }
+
+    return checks_status();
+}
@@ -0,0 +1,48 @@
+#include <array>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "util.H"
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+using namespace literals;
+
+auto main() -> int
+{
+
+    // compute a state at deriv_level = 1, then upgrade it to
+    // deriv_level = 3 reusing its η and Fermi integrals, and compare
+    // to computing the deriv_level = 3 state directly
+
+    const real_t Ye{0.5_rt};
+
+    ElectronPositronEOS<real_t, 1> eos1;
+    ElectronPositronEOS<real_t, 3> eos3;
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+
+            auto ints = get_eos_integrals(rho, T, Ye).value();
+
+            auto es1 = eos1.pe_state_from_integrals(ints);
+            auto es3_upgrade = eos3.pe_state_from_integrals(ints);
+
+            auto es3_from_state = eos3.recompute_state_at_eta(es1);
+
+            auto es3 = eos3.pe_state(rho, T, Ye);
+
+            const bool same =
+                es3_upgrade.p == es3.p && es3_upgrade.dp_dT == es3.dp_dT &&
+                es3_upgrade.d2s_dT2 == es3.d2s_dT2 && es3_upgrade.d3e_drho2dT == es3.d3e_drho2dT &&
+                es3_from_state.d3s_drho2dT == es3.d3s_drho2dT && es1.p == es3.p;
+
+            if (same) {
+                util::green_println("ρ = {:8.3g} T = {:8.3g}: upgraded state agrees", rho, T);
+            } else {
+                util::red_println("ρ = {:8.3g} T = {:8.3g}: upgraded state differs", rho, T);
+            }
+        }
+    }
+}
@@ -0,0 +1,71 @@
+#include <array>
+#include <vector>
+
+#include "real_type.H"
+#include "electron_positron.H"
+#include "util.H"
+
+const std::array<real_t, 4> Ts{1.e5_rt, 1.e7_rt, 1.e9_rt, 5.e9_rt};
+const std::array<real_t, 4> rhos{1.e-2_rt, 1.e2_rt, 1.e5_rt, 1.e7_rt};
+
+using namespace literals;
+
+// check that a state computed with a quantity mask agrees exactly with
+// the full state for the fields that were requested
+
+template <WantMask want>
+void check(const char* name, const std::vector<real_t EOSState<real_t>::*>& fields)
+{
+    ElectronPositronEOS<real_t> eos;
+
+    const real_t Ye{0.5_rt};
+
+    int n_fail{};
+
+    for (auto T : Ts) {
+        for (auto rho : rhos) {
+            auto es_full = eos.pe_state(rho, T, Ye);
+            auto es = eos.pe_state<want>(rho, T, Ye);
+
+            for (auto f : fields) {
+                if (es.*f != es_full.*f) {
+                    util::red_println("{}: ρ = {:8.3g} T = {:8.3g}: {} != {}",
+                                      name, rho, T, es.*f, es_full.*f);
+                    ++n_fail;
+                }
+            }
+        }
+    }
+
+    if (n_fail == 0) {
+        util::green_println("{}: passed", name);
+    }
+}
+
+auto main() -> int
+{
+
+    check<Want::p>("p",
+                   {&EOSState<real_t>::p, &EOSState<real_t>::p_e, &EOSState<real_t>::p_pos,
+                    &EOSState<real_t>::n, &EOSState<real_t>::eta});
+
+    check<Want::p | Want::e | Want::d1>("p, e, d1",
+                                        {&EOSState<real_t>::p, &EOSState<real_t>::dp_drho, &EOSState<real_t>::dp_dT,
+                                         &EOSState<real_t>::e, &EOSState<real_t>::de_drho, &EOSState<real_t>::de_dT,
+                                         &EOSState<real_t>::deta_drho, &EOSState<real_t>::deta_dT});
+
+    check<Want::n | Want::d2>("n, d2",
+                              {&EOSState<real_t>::n, &EOSState<real_t>::dn_drho, &EOSState<real_t>::d2n_drhodT,
+                               &EOSState<real_t>::d2eta_dT2});
+
+    // unless the entropy is computed directly, it needs the pressure
+
+    std::vector<real_t EOSState<real_t>::*> s_fields{&EOSState<real_t>::s, &EOSState<real_t>::ds_dT,
+                                                     &EOSState<real_t>::d2s_drho2, &EOSState<real_t>::d3s_drho2dT};
+    if (!cancellation_free) {
+        s_fields.push_back(&EOSState<real_t>::d3p_dT3);
+    }
+
+    check<Want::s | Want::d3>("s, d3", s_fields);
+
+}
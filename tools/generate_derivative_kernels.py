@@ -0,0 +1,691 @@
+#!/usr/bin/env python3
+
+"""Generate src/derivative_kernels.H, the derivative kernels of
+electron_positron.H, with SymPy.
+
+These are the expressions derived in notes/degenerate_derivatives.ipynb:
+
+  eta_beta_derivs         the η and β derivatives of
+                          q = A β^{p/2} (F_x + c β F_y) for electrons
+                          (at η) and positrons (at η̃ = -η - 2/β)
+                          (get_eta_beta_derivs)
+  eta_thermo_derivs       the ρ and T derivatives of η(ρ, T) from
+                          n⁻(η, β) - n⁺(η, β) = N_A Y_e ρ
+                          (get_eta_thermo_derivs)
+  chain_rule              the ρ and T derivatives of f(η(ρ, T), β(T))
+                          (chain_rule)
+  entropy_density_derivs  the ρ and T derivatives of the entropy per
+                          volume, S = (E + P) / T - σ k η n, for the
+                          entropy section of pe_state
+
+Rather than differentiating unknown functions (which gives SymPy
+Derivative and Subs objects), each function of (η, β) or (ρ, T) is
+written as its Taylor polynomial about the point with the derivatives
+as symbols.  Differentiating the composition and evaluating at the
+point then gives the chain rule to any order.
+
+Each kernel is emitted once per deriv_level (1, 2, 3), with common
+subexpression elimination over all of its outputs, and with integer
+powers evaluated by multiplication.  With --report, this prints the
+number of operations before and after.
+
+usage: generate_derivative_kernels.py [--report] [-o src/derivative_kernels.H]
+"""
+
+import argparse
+import math
+from pathlib import Path
+
+import sympy
+from sympy import Add, Integer, Mul, Pow, Symbol, symbols
+
+
+# the derivatives, in the order they appear in EtaBetaDerivs and
+# RhoTDerivs, as (i, j) for ∂ⁱ/∂uⁱ ∂ʲ/∂vʲ
+
+DERIVS = [(1, 0), (0, 1),
+          (2, 0), (1, 1), (0, 2),
+          (3, 0), (2, 1), (1, 2), (0, 3)]
+
+
+def order_of(ij):
+    return ij[0] + ij[1]
+
+
+def deriv_name(ij, u, v):
+    """the name of a derivative in EtaBetaDerivs and RhoTDerivs, e.g.,
+    (2, 1) with (u, v) = (eta, beta) is deta2dbeta"""
+    i, j = ij
+    name = ""
+    if i > 0:
+        name += f"d{u}" + (str(i) if i > 1 else "")
+    if j > 0:
+        name += f"d{v}" + (str(j) if j > 1 else "")
+    return name
+
+
+def eta_beta_field(ij):
+    return deriv_name(ij, "eta", "beta")
+
+
+def rho_T_field(ij):
+    return deriv_name(ij, "rho", "T")
+
+
+def fermi_field(ij):
+    """the FermiIntegral member for ∂ⁱ∂ʲF/∂ηⁱ∂βʲ"""
+    if ij == (0, 0):
+        return "F"
+    n = order_of(ij)
+    return f"d{n if n > 1 else ''}F_{eta_beta_field(ij)}"
+
+
+def taylor(coeffs, du, dv, order):
+    """Σ c_ij du^i dv^j / (i! j!) with coeffs[(i, j)] = c_ij"""
+    return sum(coeffs[(i, j)] * du**i * dv**j / (math.factorial(i) * math.factorial(j))
+               for i in range(order + 1) for j in range(order + 1 - i)
+               if (i, j) in coeffs)
+
+
+def derivatives_at_point(expr, du, dv, order):
+    """the derivatives of expr with respect to du and dv at du = dv = 0"""
+    result = {}
+    for ij in DERIVS:
+        if order_of(ij) > order:
+            continue
+        i, j = ij
+        d = expr
+        if i > 0:
+            d = sympy.diff(d, du, i)
+        if j > 0:
+            d = sympy.diff(d, dv, j)
+        result[ij] = d.subs({du: 0, dv: 0})
+    return result
+
+
+# ---------------------------------------------------------------------------
+# the kernels
+
+def fermi_symbols(name):
+    return {ij: Symbol(f"{name}.{fermi_field(ij)}")
+            for ij in [(0, 0)] + DERIVS}
+
+
+def eta_beta_derivs(order):
+    """∂q/∂η... and ∂w/∂η... for q = A β^{p/2} (F_x + c β F_y)"""
+
+    A, c, p, beta = symbols("A c p beta", positive=True)
+    deta, dbeta = symbols("deta_ dbeta_")
+
+    fx = fermi_symbols("fx")
+    fy = fermi_symbols("fy")
+    fx_pos = fermi_symbols("fx_pos")
+    fy_pos = fermi_symbols("fy_pos")
+
+    b = beta + dbeta
+    prefactor = A * b**(p / 2)
+
+    # electrons: F(η + dη, β + dβ)
+    q = prefactor * (taylor(fx, deta, dbeta, order) + c * b * taylor(fy, deta, dbeta, order))
+
+    # positrons: F(η̃ + dη̃, β + dβ), with η̃ = -η - 2/β
+    deta_tilde = -deta - 2 / b + 2 / beta
+    w = prefactor * (taylor(fx_pos, deta_tilde, dbeta, order) +
+                     c * b * taylor(fy_pos, deta_tilde, dbeta, order))
+
+    dq = derivatives_at_point(q, deta, dbeta, order)
+    dw = derivatives_at_point(w, deta, dbeta, order)
+
+    # β^{p/2 + k} -> betap2 β^k, evaluated once with mp::pow
+
+    betap2 = Symbol("betap2")
+
+    def split_betap2(e):
+        return e.replace(lambda x: x.is_Pow and x.base == beta and x.exp.has(p),
+                         lambda x: betap2 * beta**sympy.expand(x.exp - p / 2))
+
+    outputs = []
+    for ij, e in dq.items():
+        outputs.append((f"dq.{eta_beta_field(ij)}", split_betap2(e)))
+    for ij, e in dw.items():
+        outputs.append((f"dw.{eta_beta_field(ij)}", split_betap2(e)))
+
+    prelude = [("betap2", "mp::pow(beta, p / 2.0_rt)")]
+
+    return prelude, [outputs], {beta: Symbol("betai")}
+
+
+def eta_thermo_derivs(order):
+    """∂η/∂ρ... from n⁻(η(ρ, T), β(T)) - n⁺(η(ρ, T), β(T)) = N_A Y_e ρ,
+    solved order by order.  Each derivative is written in terms of the
+    lower-order ones (as deta.*), like the chain rule would be by hand."""
+
+    drho, dT = symbols("drho_ dT_")
+    Ye, N_A, dbdT, denomi = symbols("Ye N_A dbdT denomi")
+
+    # the derivatives of n⁻ - n⁺, formed once
+
+    dn = {ij: Symbol(f"dn_{eta_beta_field(ij)}") for ij in DERIVS if order_of(ij) <= order}
+    dn[(0, 0)] = Integer(0)
+
+    deta = {ij: Symbol(f"deta.{rho_T_field(ij)}") for ij in DERIVS}
+
+    eta_of = taylor(deta, drho, dT, order)
+    beta_of = dbdT * dT
+
+    lhs = taylor(dn, eta_of, beta_of, order)
+    rhs = N_A * Ye * drho
+
+    residual = derivatives_at_point(lhs - rhs, drho, dT, order)
+
+    # each residual is linear in the highest derivative of η, with
+    # coefficient ∂(n⁻ - n⁺)/∂η
+
+    groups = [[] for _ in range(order)]
+    for ij in DERIVS:
+        if order_of(ij) > order:
+            continue
+        r = sympy.expand(residual[ij])
+        coeff = r.coeff(deta[ij])
+        assert coeff == dn[(1, 0)]
+        rest = sympy.expand(r - coeff * deta[ij])
+        groups[order_of(ij) - 1].append((f"deta.{rho_T_field(ij)}", -rest * denomi))
+
+    prelude = [("dbdT", "C::values<T>().dbeta_dT"),
+               ("N_A", "C::values<T>().N_A")]
+    prelude += [(f"dn_{eta_beta_field(ij)}", f"dn_e.{eta_beta_field(ij)} - dn_pos.{eta_beta_field(ij)}")
+                for ij in DERIVS if order_of(ij) <= order]
+    prelude += [("denomi", "1.0_rt / dn_deta")]
+
+    return prelude, groups, {}
+
+
+def chain_rule(order):
+    """∂f/∂ρ... for f(η(ρ, T), β(T))"""
+
+    drho, dT = symbols("drho_ dT_")
+    dbdT = Symbol("dbdT")
+
+    df = {ij: Symbol(f"df.{eta_beta_field(ij)}") for ij in DERIVS}
+    df[(0, 0)] = Integer(0)
+    deta = {ij: Symbol(f"deta.{rho_T_field(ij)}") for ij in DERIVS}
+
+    f = taylor(df, taylor(deta, drho, dT, order), dbdT * dT, order)
+
+    outputs = [(f"df_th.{rho_T_field(ij)}", e)
+               for ij, e in derivatives_at_point(f, drho, dT, order).items()]
+
+    prelude = [("dbdT", "C::values<T>().dbeta_dT")]
+
+    return prelude, [outputs], {}
+
+
+def entropy_density_derivs(order):
+    """∂S/∂ρ... for S = (E + P) / T - σ k η n, with E, P, n, and η
+    given with their ρ and T derivatives"""
+
+    drho, dT = symbols("drho_ dT_")
+    temp, temp_inv, sigma, k_B = symbols("temp temp_inv sigma k_B", positive=True)
+
+    def quantity(name, deriv_name):
+        coeffs = {ij: Symbol(f"{deriv_name}{rho_T_field(ij)}") for ij in DERIVS}
+        coeffs[(0, 0)] = Symbol(name)
+        return taylor(coeffs, drho, dT, order)
+
+    # the enthalpy per volume, E + P, is formed once
+
+    H = quantity("H", "dH_")
+    n = quantity("n", "dn.")
+    eta = quantity("eta", "deta.")
+
+    S = H / (temp + dT) - sigma * k_B * eta * n
+
+    outputs = [(f"dS.{rho_T_field(ij)}", e.subs(temp, 1 / temp_inv))
+               for ij, e in derivatives_at_point(S, drho, dT, order).items()]
+
+    prelude = [("k_B", "C::values<T>().k"),
+               ("H", "E + P")]
+    prelude += [(f"dH_{rho_T_field(ij)}", f"dE.{rho_T_field(ij)} + dP.{rho_T_field(ij)}")
+                for ij in DERIVS if order_of(ij) <= order]
+
+    return prelude, [outputs], {}
+
+
+# ---------------------------------------------------------------------------
+# operation counts
+
+class OpCount:
+
+    def __init__(self, add=0, mul=0, div=0, call=0):
+        self.add = add
+        self.mul = mul
+        self.div = div
+        self.call = call
+
+    def __iadd__(self, other):
+        self.add += other.add
+        self.mul += other.mul
+        self.div += other.div
+        self.call += other.call
+        return self
+
+    def total(self):
+        return self.add + self.mul + self.div + self.call
+
+
+def count_ops(e, powers=None):
+    """the operations needed to evaluate e as printed: integer powers
+    by repeated multiplication (or from powers, if they are there),
+    negative ones with a division, and negation free"""
+
+    ops = OpCount()
+
+    if e.is_Atom:
+        return ops
+
+    if isinstance(e, Add):
+        ops.add += len(e.args) - 1
+    elif isinstance(e, Mul):
+        coeff, rest = e.as_coeff_Mul()
+        factors = list(Mul.make_args(rest))
+        ops.mul += len(factors) - 1 + (1 if abs(coeff) != 1 else 0)
+    elif isinstance(e, Pow):
+        if e.exp.is_Integer:
+            k = abs(int(e.exp))
+            if int(e.exp) < 0:
+                ops.div += 1
+            if powers is None or (e.base, k) not in powers:
+                ops.mul += k - 1
+            return ops if e.base.is_Atom else _add(ops, count_ops(e.base, powers))
+        ops.call += 1
+
+    for a in e.args:
+        ops += count_ops(a, powers)
+
+    return ops
+
+
+def count_cxx_ops(s):
+    """the operations in a line of C++ from the preludes (these are
+    simple enough that the binary operators can just be counted)"""
+    return OpCount(add=s.count(" + ") + s.count(" - "), mul=s.count(" * "),
+                   div=s.count(" / "), call=s.count("mp::pow("))
+
+
+def _add(a, b):
+    a += b
+    return a
+
+
+# ---------------------------------------------------------------------------
+# C++ output
+
+def is_power_of_two(q):
+    return q > 0 and q & (q - 1) == 0
+
+
+class KernelPrinter:
+    """prints an expression as C++, with the integer powers of symbols
+    taken from the temporaries in powers"""
+
+    def __init__(self, powers):
+        self.powers = powers
+
+    def number(self, x):
+        if x.is_Integer:
+            return f"{int(x)}.0_rt"
+        return f"{float(x)!r}_rt"
+
+    def factor(self, e):
+        if isinstance(e, Add) or (isinstance(e, Mul) and e.could_extract_minus_sign()):
+            return f"({self.expr(e)})"
+        return self.expr(e)
+
+    def denominator(self, e):
+        if isinstance(e, (Add, Mul)):
+            return f"({self.expr(e)})"
+        return self.expr(e)
+
+    def expr(self, e):
+        if e.is_Number:
+            if e < 0:
+                return f"-{self.number(-e)}"
+            return self.number(e)
+
+        if e.is_Symbol:
+            return e.name
+
+        if isinstance(e, Add):
+            terms = e.as_ordered_terms()
+            s = self.expr(terms[0])
+            for t in terms[1:]:
+                if t.could_extract_minus_sign():
+                    s += f" - {self.expr(-t)}"
+                else:
+                    s += f" + {self.expr(t)}"
+            return s
+
+        if isinstance(e, Mul):
+            if e.could_extract_minus_sign():
+                return f"-{self.factor(-e)}"
+
+            coeff, rest = e.as_coeff_Mul()
+            num = []
+            den = []
+
+            # rationals that are not exact in binary are divisions
+            if coeff != 1:
+                if coeff.is_Rational and not is_power_of_two(coeff.q):
+                    if coeff.p != 1:
+                        num.append(self.number(Integer(coeff.p)))
+                    den.append(Integer(coeff.q))
+                else:
+                    num.append(self.number(coeff))
+
+            for a in Mul.make_args(rest):
+                if isinstance(a, Pow) and a.exp.is_Integer and a.exp < 0:
+                    den.append(Pow(a.base, -a.exp))
+                else:
+                    num.append(self.factor(a))
+
+            s = " * ".join(num) if num else "1.0_rt"
+            if den:
+                s += " / " + self.denominator(Mul(*den, evaluate=False) if len(den) > 1 else den[0])
+            return s
+
+        if isinstance(e, Pow):
+            if e.exp.is_Integer:
+                k = int(e.exp)
+                if k < 0:
+                    return f"1.0_rt / {self.denominator(Pow(e.base, -k))}"
+                if (e.base, k) in self.powers:
+                    return self.powers[(e.base, k)]
+                return " * ".join([self.factor(e.base)] * k)
+            return f"mp::pow({self.expr(e.base)}, {self.expr(e.exp)})"
+
+        raise ValueError(f"cannot print {e}")
+
+    def output(self, e, compensate):
+        """an output, with its top-level sum through sum_terms (so it
+        is compensated with USE_COMPENSATED_SUM) if compensate"""
+
+        if compensate:
+            if isinstance(e, Add) and len(e.args) > 2:
+                return self.sum_terms(e)
+
+            if isinstance(e, Mul):
+                adds = [a for a in e.args if isinstance(a, Add)]
+                if len(adds) == 1 and len(adds[0].args) > 2:
+                    rest = sympy.Mul(*[a for a in e.args if a is not adds[0]])
+                    if rest == 1:
+                        return self.sum_terms(adds[0])
+                    if rest.could_extract_minus_sign():
+                        return f"-{self.output(-e, compensate)}"
+                    return f"{self.factor(rest)} * {self.sum_terms(adds[0])}"
+
+        return self.expr(e)
+
+    def sum_terms(self, e):
+        return f"sum_terms<T>({', '.join(self.expr(t) for t in e.as_ordered_terms())})"
+
+
+def integer_powers(exprs):
+    """{base: {k}} for the integer powers |k| >= 2 of symbols in exprs"""
+
+    wanted = {}
+    for e in exprs:
+        for x in sympy.preorder_traversal(e):
+            if isinstance(x, Pow) and x.base.is_Symbol and x.exp.is_Integer and abs(int(x.exp)) >= 2:
+                wanted.setdefault(x.base, set()).add(abs(int(x.exp)))
+    return wanted
+
+
+def power_chain(base, ks):
+    """the statements computing base**k for each k in ks by
+    multiplication, each from two lower powers"""
+
+    def name(k):
+        return base.name if k == 1 else f"{base.name.replace('.', '_')}_{k}"
+
+    need = set()
+
+    def add(k):
+        if k > 1 and k not in need:
+            need.add(k)
+            add(k // 2)
+            add(k - k // 2)
+
+    for k in ks:
+        add(k)
+
+    return [((base, k), name(k), f"{name(k // 2)} * {name(k - k // 2)}") for k in sorted(need)]
+
+
+def rewrite_inverses(e, inverses):
+    """b^{-k} -> (1/b)^k for the bases in inverses, so the division is
+    done once"""
+    for b, bi in inverses.items():
+        e = e.replace(lambda x, b=b: isinstance(x, Pow) and x.base == b and x.exp.is_Integer and x.exp < 0,
+                      lambda x, bi=bi: bi**(-x.exp))
+    return e
+
+
+def generate_block(prelude, groups, inverses, compensate):
+    """the C++ statements for one deriv_level, with the operation counts
+    as derived and as generated.  groups are lists of (name, expression)
+    outputs, where an expression may use the outputs of the earlier
+    groups; each group is its own common subexpression elimination."""
+
+    temps = sympy.numbered_symbols("t")
+
+    derived = OpCount(div=len(inverses))
+    for _, value in prelude:
+        derived += count_cxx_ops(value)
+
+    # (name, expression, is_output)
+    statements = []
+    known = {}
+
+    for outputs in groups:
+        exprs = [rewrite_inverses(sympy.factor_terms(sympy.expand(e)), inverses) for _, e in outputs]
+        for e in exprs:
+            derived += count_ops(e)
+
+        # reuse the temporaries of the earlier groups
+        exprs = [e.xreplace(known) for e in exprs]
+
+        replacements, reduced = sympy.cse(exprs, symbols=temps, optimizations="basic")
+
+        # a power of a symbol is left to the power temporaries below
+        aliases = {}
+        kept = []
+        for s, e in replacements:
+            e = e.xreplace(aliases)
+            if isinstance(e, Pow) and e.base.is_Symbol and e.exp.is_Integer:
+                aliases[s] = e
+            else:
+                kept.append((s, e))
+        replacements = kept
+        reduced = [e.xreplace(aliases) for e in reduced]
+        known.update({e: s for s, e in replacements})
+
+        statements += [(s, e, False) for s, e in replacements]
+        statements += [(Symbol(name), e, True) for (name, _), e in zip(outputs, reduced)]
+
+    # number the temporaries that are left in order
+
+    renumber = {}
+    numbered = sympy.numbered_symbols("t")
+    for s, _, is_output in statements:
+        if not is_output:
+            renumber[s] = next(numbered)
+    statements = [(renumber.get(s, s), e.xreplace(renumber), is_output) for s, e, is_output in statements]
+
+    # the integer powers are computed once, right after their base
+
+    chains = {base: power_chain(base, ks)
+              for base, ks in integer_powers([e for _, e, _ in statements]).items()}
+    powers = {key: name for chain in chains.values() for key, name, _ in chain}
+
+    printer = KernelPrinter(powers)
+    generated = OpCount(mul=len(powers))
+    for _, value in prelude:
+        generated += count_cxx_ops(value)
+
+    lines = [f"const T {name} = {value};" for name, value in prelude]
+    for b, bi in inverses.items():
+        lines.append(f"const T {bi} = 1.0_rt / {b};")
+        generated.div += 1
+
+    defined = {s for s, _, _ in statements}
+    for base in sorted(chains, key=lambda b: b.name):
+        if base not in defined:
+            lines += [f"const T {name} = {value};" for _, name, value in chains[base]]
+
+    for s, e, is_output in statements:
+        generated += count_ops(e, powers)
+        if is_output:
+            lines.append(f"{s} = {printer.output(e, compensate)};")
+        else:
+            lines.append(f"const T {s} = {printer.expr(e)};")
+        lines += [f"const T {name} = {value};" for _, name, value in chains.get(s, [])]
+
+    return lines, derived, generated
+
+
+KERNELS = [
+    ("eta_beta_derivs", eta_beta_derivs, True,
+     "template <typename T, int deriv_level=3>\n"
+     "inline auto eta_beta_derivs(const T A, const T c, const T p, const T beta,\n"
+     "                            const FermiIntegral<T>& fx, const FermiIntegral<T>& fy,\n"
+     "                            const FermiIntegral<T>& fx_pos, const FermiIntegral<T>& fy_pos)\n"
+     "    -> std::pair<EtaBetaDerivs<T>, EtaBetaDerivs<T>>",
+     ["EtaBetaDerivs<T> dq;", "EtaBetaDerivs<T> dw;"], "{dq, dw}",
+     "the η and β derivatives of q = A β^{p/2} (F_x + c β F_y) and of w,\n"
+     "// the same at η̃ = -η - 2/β (see get_eta_beta_derivs)"),
+    ("eta_thermo_derivs", eta_thermo_derivs, False,
+     "template <typename T, int deriv_level=3>\n"
+     "inline auto eta_thermo_derivs(const T Ye,\n"
+     "                              const EtaBetaDerivs<T>& dn_e, const EtaBetaDerivs<T>& dn_pos)\n"
+     "    -> RhoTDerivs<T>",
+     ["RhoTDerivs<T> deta;"], "deta",
+     "the ρ and T derivatives of η (see get_eta_thermo_derivs)"),
+    ("chain_rule", chain_rule, True,
+     "template <typename T, int deriv_level=3>\n"
+     "inline auto chain_rule(const EtaBetaDerivs<T>& df, const RhoTDerivs<T>& deta)\n"
+     "    -> RhoTDerivs<T>",
+     ["RhoTDerivs<T> df_th;"], "df_th",
+     "the ρ and T derivatives of f(η, β) (see chain_rule)"),
+    ("entropy_density_derivs", entropy_density_derivs, True,
+     "template <typename T, int deriv_level=3>\n"
+     "inline auto entropy_density_derivs(const T E, const RhoTDerivs<T>& dE,\n"
+     "                                   const T P, const RhoTDerivs<T>& dP,\n"
+     "                                   const T n, const RhoTDerivs<T>& dn,\n"
+     "                                   const T eta, const RhoTDerivs<T>& deta,\n"
+     "                                   const T sigma, const T temp_inv)\n"
+     "    -> RhoTDerivs<T>",
+     ["RhoTDerivs<T> dS;"], "dS",
+     "the ρ and T derivatives of the entropy per volume of one species,\n"
+     "// S = (E + P) / T - σ k η n, with σ = 1 for the electrons and -1\n"
+     "// for the positrons (whose degeneracy parameter is -η)"),
+]
+
+
+HEADER = """\
+#ifndef DERIVATIVE_KERNELS_H
+#define DERIVATIVE_KERNELS_H
+
+#include <utility>
+
+#include "real_type.H"
+#include "mp_math.H"
+#include "eos_types.H"
+#include "fermi_integrals.H"
+#include "compensated_sum.H"
+#include "fundamental_constants.H"
+
+// Generated by tools/generate_derivative_kernels.py -- do not edit.
+//
+// The derivative kernels of electron_positron.H, from the SymPy
+// expressions of notes/degenerate_derivatives.ipynb with common
+// subexpressions eliminated and integer powers evaluated by
+// multiplication.  These are used in place of the hand-written ones
+// with USE_GENERATED_KERNELS.
+//
+// operations per call (add, mul, div, pow), as derived and as generated:
+//
+{report}
+namespace derivative_kernels {{
+"""
+
+FOOTER = """\
+}
+
+#endif
+"""
+
+
+def indent(lines, n):
+    return [" " * n + line if line else line for line in lines]
+
+
+def main():
+
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("-o", "--output", default=Path(__file__).parent.parent / "src" / "derivative_kernels.H",
+                        type=Path, help="the header to write")
+    parser.add_argument("--report", action="store_true", help="print the operation counts")
+    args = parser.parse_args()
+
+    report = []
+    body = []
+
+    for name, kernel, compensate, signature, decls, ret, doc in KERNELS:
+
+        body.append("")
+        body.append(f"// {doc}")
+        body.append("")
+        body.append(signature)
+        body.append("{")
+        body.append("    static_assert(deriv_level >= 1 && deriv_level <= 3);")
+        body.append("")
+        body += indent(decls, 4)
+        body.append("")
+
+        for level in (1, 2, 3):
+            prelude, outputs, inverses = kernel(level)
+            lines, naive, generated = generate_block(prelude, outputs, inverses, compensate)
+
+            keyword = "if constexpr" if level == 1 else "} else if constexpr"
+            body.append(f"    {keyword} (deriv_level == {level}) {{")
+            body += indent(lines, 8)
+
+            report.append((name, level, naive, generated))
+
+        body.append("    }")
+        body.append("")
+        body.append(f"    return {ret};")
+        body.append("}")
+
+    width = max(len(name) for name, *_ in report)
+    report_lines = []
+    for name, level, naive, generated in report:
+        report_lines.append(f"//   {name:<{width}} {level}   "
+                            f"{naive.add:4d} {naive.mul:4d} {naive.div:3d} {naive.call:2d}  ->  "
+                            f"{generated.add:4d} {generated.mul:4d} {generated.div:3d} {generated.call:2d}")
+
+    with open(args.output, "w") as of:
+        of.write(HEADER.format(report="\n".join(report_lines) + "\n"))
+        of.write("\n".join(body) + "\n")
+        of.write("\n" + FOOTER)
+
+    if args.report:
+        print(f"{'kernel':<{width}} order    derived (add mul div pow)      generated (add mul div pow)")
+        for name, level, naive, generated in report:
+            print(f"{name:<{width}} {level:5d}    {naive.add:5d} {naive.mul:5d} {naive.div:4d} {naive.call:3d}"
+                  f"  {naive.total():6d}    {generated.add:5d} {generated.mul:5d} {generated.div:4d} {generated.call:3d}"
+                  f"  {generated.total():6d}")
+
+
+if __name__ == "__main__":
+    main()